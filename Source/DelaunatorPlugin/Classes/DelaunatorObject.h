@@ -32,9 +32,16 @@
 #include "DelaunatorCompareOperator.h"
 #include "GULTypes.h"
 #include "Geom/GULGeometryUtilityLibrary.h"
+#include "Async/Future.h"
+#include "Engine/LatentActionManager.h"
 #include "DelaunatorObject.generated.h"
 
 class UDelaunatorVoronoi;
+class FDelaunatorStreamMesh;
+struct FDelaunatorObjectBuild;
+
+// Ref-counted handle to a caller owned point buffer
+typedef TSharedRef<const TArray<FVector2D>, ESPMode::ThreadSafe> FDelaunatorSharedPoints;
 
 UCLASS(BlueprintType)
 class DELAUNATORPLUGIN_API UDelaunatorObject : public UObject
@@ -49,9 +56,35 @@ class DELAUNATORPLUGIN_API UDelaunatorObject : public UObject
     TArray<int32> Inedges;
     //TBitArray<> BoundaryFlags;
 
+    // Shared points referenced in place of Points when valid
+    TSharedPtr<const TArray<FVector2D>, ESPMode::ThreadSafe> SharedPoints;
+
+    // Serial of the latest update or edit, older async results are dropped
+    uint32 BuildSerial = 0;
+
+    // Allocation size last added to the memory stat
+    SIZE_T StatAllocatedSize = 0;
+
+    // Uniform grid of walk start points for FindPoint, empty when disabled
+    bool bUsePointGrid = false;
+    TArray<int32> PointGrid;
+    FVector2D PointGridOrigin;
+    FVector2D PointGridScale;
+    FIntPoint PointGridDimension;
+
+    // Compressed neighbour lists, neighbours of point i are stored in
+    // NeighbourIndices[NeighbourOffsets[i], NeighbourOffsets[i+1])
+    bool bUseNeighbourCache = false;
+    TArray<int32> NeighbourOffsets;
+    TArray<int32> NeighbourIndices;
+
     UPROPERTY()
     TMap<FName, UDelaunatorValueObject*> ValueMap;
 
+    // Names of owned value objects created per point
+    UPROPERTY()
+    TSet<FName> PointValueNames;
+
     UPROPERTY()
     TMap<FName, FGULIntGroup> IndexGroupMap;
 
@@ -97,8 +130,54 @@ class DELAUNATORPLUGIN_API UDelaunatorObject : public UObject
     void GetPointNeighboursBoundary(TArray<int32>& OutNeighbourIndices, int32 InTrianglePointIndex) const;
     void GetPointNeighboursNonBoundary(TArray<int32>& OutNeighbourIndices, int32 InTrianglePointIndex) const;
 
+    void UpdateTopology();
+    void UpdateHull();
+
+    static void UpdateTopology(
+        const delaunator::Delaunator& InDelaunator,
+        int32 PointCount,
+        TArray<int32>& OutHull,
+        TArray<int32>& OutHullIndex,
+        TArray<int32>& OutInedges
+        );
+
+    static void UpdateHull(
+        const delaunator::Delaunator& InDelaunator,
+        TArray<int32>& OutHull,
+        TArray<int32>& OutHullIndex
+        );
+
+    bool PublishBuild(FDelaunatorObjectBuild& Build);
+    void UpdateFromTriangulation(TArray<FVector2D>&& InPoints, TArray<int32>&& InTriangles, TArray<int32>&& InHalfEdges);
+
+    // True if edges without a twin form a single convex loop
+    static bool HasConvexBoundary(
+        const TArray<FVector2D>& InPoints,
+        const TArray<int32>& InTriangles,
+        const TArray<int32>& InHalfEdges
+        );
+    void DetachSharedPoints();
+    void UpdateInedges(const TArray<int32>& InTriangleIndices);
+
+    // Publish and reset triangulator counters, refresh the memory stat
+    void UpdateStats();
+
+    int32 FindWalkStartTriangle(const FVector2D& TargetPoint, int32 HintTriangle) const;
+
+    void UpdatePointGrid();
+    void UpdatePointGridCell(int32 PointIndex);
+    void UpdateNeighbourCache();
+    void InvalidateNeighbourCache();
+    int32 FindPointGridCell(const FVector2D& Point) const;
+    int32 WalkToPoint(const FVector2D& TargetPoint, int32 InitialPoint, uint32& InOutIterationCount) const;
+
+    // False outside the hull, OutTriangle is then the hull triangle reached
+    bool WalkToTriangle(const FVector2D& TargetPoint, int32 HintTriangle, int32& OutTriangle, FVector& OutWeights) const;
+
 public:
 
+    virtual void BeginDestroy() override;
+
     const TArray<FVector2D>& GetPoints() const;
     const TArray<int32>& GetTriangles() const;
     const TArray<int32>& GetHalfEdges() const;
@@ -125,9 +204,136 @@ public:
     UFUNCTION(BlueprintCallable, Category="Delaunator")
     bool IsValidDelaunatorObject() const;
 
+    // Copy triangulation into narrowed index storage for resident meshes,
+    // false if the object is invalid or its indices do not fit
+    template<typename FPointIndex, typename FEdgeIndex>
+    bool CopyCompactMesh(delaunator::TCompactMesh<FPointIndex, FEdgeIndex>& OutMesh) const
+    {
+        return IsValidDelaunatorObject()
+            && OutMesh.assign(GetTriangles(), GetHalfEdges(), GetInedges(), GetHull());
+    }
+
+    // Restore a triangulation of InPoints from narrowed index storage
+    template<typename FPointIndex, typename FEdgeIndex>
+    void UpdateFromCompactMesh(TArray<FVector2D>&& InPoints, const delaunator::TCompactMesh<FPointIndex, FEdgeIndex>& InMesh)
+    {
+        TArray<int32> NewTriangles;
+        TArray<int32> NewHalfEdges;
+        InMesh.expand(NewTriangles, NewHalfEdges);
+        UpdateFromTriangulation(MoveTemp(InPoints), MoveTemp(NewTriangles), MoveTemp(NewHalfEdges));
+    }
+
     UFUNCTION(BlueprintCallable, Category="Delaunator")
     void UpdateFromPoints(const TArray<FVector2D>& InPoints);
 
+    // Triangulate taking ownership of the point array without a copy
+    void UpdateFromPoints(TArray<FVector2D>&& InPoints);
+
+    // Exact predicates for near-degenerate input, slower on regular input
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void SetRobustPredicates(bool bEnabled);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsUsingRobustPredicates() const;
+
+    // Keep triangulation buffers allocated between updates of similar size
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void SetRetainCapacity(bool bEnabled);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsRetainingCapacity() const;
+
+    // Index walk start points on a uniform grid rebuilt by every update,
+    // FindPoint without an initial point then takes O(1) expected hops.
+    // Inserted points fill their grid cells, which gives InsertPoints the
+    // same expected walk. Other point edits keep the grid, removed start
+    // points fall back to a walk.
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void SetPointGridEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsPointGridEnabled() const;
+
+    // Cache point neighbours in one contiguous buffer rebuilt in parallel
+    // by every full update, neighbour traversals then read views instead
+    // of walking halfedges. Point edits and constraint inserts invalidate
+    // the cache, call RebuildNeighbourCache() after a batch of edits.
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void SetNeighbourCacheEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void RebuildNeighbourCache();
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsNeighbourCacheEnabled() const;
+
+    bool HasNeighbourCache() const;
+
+    // Cached point neighbours, requires the neighbour cache
+    TArrayView<const int32> GetPointNeighboursView(int32 PointIndex) const;
+
+    // Cached point neighbours if available, otherwise gathered into OutScratch
+    TArrayView<const int32> GetPointNeighboursView(int32 PointIndex, TArray<int32>& OutScratch) const;
+
+    // Number of buffer growths made by triangulation updates so far
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    int32 GetAllocationCount() const;
+
+    // Triangulate in parallel x-slabs, SlabCount <= 0 uses all logical cores
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void UpdateFromPointsParallel(const TArray<FVector2D>& InPoints, int32 SlabCount = 0);
+    void UpdateFromPointsParallel(TArray<FVector2D>&& InPoints, int32 SlabCount = 0);
+
+    // Triangulate on a background task, queries keep the previous state
+    // until the result is published on the game thread. Any later update
+    // or edit (insert, remove, move, renumber or constrain) supersedes
+    // the pending result. The future is false if the update is superseded
+    // or has less than 3 points.
+    TFuture<bool> UpdateFromPointsAsync(const TArray<FVector2D>& InPoints);
+    TFuture<bool> UpdateFromPointsAsync(TArray<FVector2D>&& InPoints);
+
+    // Triangulate a shared point buffer in place without a copy, the buffer
+    // must stay unchanged while referenced. Point edits detach a local copy.
+    // SlabCount other than 1 triangulates in parallel slabs.
+    void UpdateFromSharedPoints(const FDelaunatorSharedPoints& InPoints, int32 SlabCount = 1);
+
+    // Load the streamed triangles with all points within bounds through
+    // the mesh pages. Windows whose triangles do not form one convex region
+    // are retriangulated from their points, which keeps the streamed
+    // triangles and adds the missing ones up to the convex hull.
+    // OutPointIndices maps to streamed point indices.
+    bool UpdateFromStreamMesh(FDelaunatorStreamMesh& Mesh, const FBox2D& Bounds, TArray<int32>& OutPointIndices);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator", meta=(Latent, LatentInfo="LatentInfo", WorldContext="WorldContextObject"))
+    void UpdateFromPointsLatent(UObject* WorldContextObject, const TArray<FVector2D>& InPoints, FLatentActionInfo LatentInfo);
+
+    // Insert points into existing triangulation with local edge flips
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void InsertPoints(const TArray<FVector2D>& InPoints);
+
+    // Remove points with local retriangulation. Removed points keep their
+    // index and position but are no longer part of the triangulation.
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void RemovePoints(const TArray<int32>& InPointIndices);
+
+    // Move points, repairing the triangulation with local edge flips.
+    // A point whose local repair would degenerate the triangulation keeps
+    // its previous position. Returns false if any point was not moved.
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool MovePoints(const TArray<int32>& InPointIndices, const TArray<FVector2D>& InPositions);
+
+    // Renumber points along a hilbert curve and sort triangles to match for
+    // cache coherent traversal. OutPointOrder maps new to old point index.
+    // Point value objects created by CreateDefaultPointValueObject() are
+    // remapped, other value objects and index groups are left for the
+    // caller to remap.
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void RenumberPointsSpatially(TArray<int32>& OutPointOrder);
+
+    // False for removed and skipped coincident points
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsTriangulatedPoint(int32 PointIndex) const;
+
     UFUNCTION(BlueprintCallable, Category="Delaunator")
     void CopyIndices(TArray<int32>& OutTriangles, TArray<int32>& OutHalfEdges);
 
@@ -259,6 +465,31 @@ public:
     UFUNCTION(BlueprintCallable, Category="Delaunator", meta=(DisplayName="Find Point"))
     int32 K2_FindPoint(const FVector2D& TargetPoint, int32 InitialPoint = -1);
     int32 FindPoint(const FVector2D& TargetPoint, int32 InitialPoint = -1) const;
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator", meta=(DisplayName="Find Points"))
+    void K2_FindPoints(TArray<int32>& OutPointIndices, const TArray<FVector2D>& InTargetPoints);
+
+    // Batched FindPoint over parallel chunks of hilbert sorted queries,
+    // each walk starts from the previous result. Same results as FindPoint
+    // except for queries with several equidistant closest points.
+    void FindPoints(TArrayView<const FVector2D> InTargetPoints, TArrayView<int32> OutPointIndices) const;
+
+    // Triangle containing the target point with barycentric weights of its
+    // corners in triangle index order, -1 outside the hull
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    int32 LocateTriangle(const FVector2D& TargetPoint, FVector& OutWeights, int32 HintTriangle = -1) const;
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator", meta=(DisplayName="Interpolate Values"))
+    void K2_InterpolateValues(TArray<float>& OutValues, UDelaunatorValueObject* ValueObject, const TArray<FVector2D>& InPositions);
+
+    // Blend point values linearly over the triangles containing the
+    // positions, positions outside the hull take their closest point value.
+    // Runs like FindPoints with each walk starting from the previous triangle.
+    void InterpolateValues(
+        const UDelaunatorValueObject* ValueObject,
+        TArrayView<const FVector2D> InPositions,
+        TArrayView<float> OutValues
+        ) const;
     int32 FindCloser(int32 i, const FVector2D& TargetPoint) const;
 
     // Boundary Utility
@@ -294,6 +525,20 @@ public:
         bool bAllowDirectConnection = false
         );
 
+    // Insert poly group segments as constrained edges
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool InsertConstraints(const TArray<FGULIntGroup>& InPolyGroups, bool bClosedPoly = true);
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    bool IsConstrainedEdge(int32 HalfEdgeIndex) const;
+
+    // Triangle nesting depth within constrained polys, odd depths are inside
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void GetConstrainedRegionDepths(TArray<int32>& OutDepths) const;
+
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    void FindConstrainedPolyTriangles(TArray<int32>& OutInnerTriangles, TArray<int32>& OutOuterTriangles) const;
+
     // Voronoi Utility
 
     UFUNCTION(BlueprintCallable, Category="Delaunator")
@@ -302,16 +547,88 @@ public:
 
 FORCEINLINE bool UDelaunatorObject::IsValidDelaunatorObject() const
 {
-    return Points.Num() >= 3
+    return GetPoints().Num() >= 3
         && Hull.Num() >= 3
         && Delaunator.triangles.Num() >= 3
         && Delaunator.triangles.Num() == Delaunator.halfedges.Num()
-        && Inedges.Num() == Points.Num();
+        && Inedges.Num() == GetPoints().Num();
+}
+
+FORCEINLINE void UDelaunatorObject::SetRobustPredicates(bool bEnabled)
+{
+    Delaunator.robust_predicates = bEnabled;
+}
+
+FORCEINLINE bool UDelaunatorObject::IsUsingRobustPredicates() const
+{
+    return Delaunator.robust_predicates;
+}
+
+FORCEINLINE void UDelaunatorObject::SetRetainCapacity(bool bEnabled)
+{
+    Delaunator.retain_capacity = bEnabled;
+}
+
+FORCEINLINE bool UDelaunatorObject::IsRetainingCapacity() const
+{
+    return Delaunator.retain_capacity;
+}
+
+FORCEINLINE bool UDelaunatorObject::IsPointGridEnabled() const
+{
+    return bUsePointGrid;
+}
+
+FORCEINLINE bool UDelaunatorObject::IsNeighbourCacheEnabled() const
+{
+    return bUseNeighbourCache;
+}
+
+FORCEINLINE bool UDelaunatorObject::HasNeighbourCache() const
+{
+    return NeighbourOffsets.Num() > 0;
+}
+
+FORCEINLINE TArrayView<const int32> UDelaunatorObject::GetPointNeighboursView(int32 PointIndex) const
+{
+    check(HasNeighbourCache());
+    const int32 Offset = NeighbourOffsets[PointIndex];
+    return MakeArrayView(NeighbourIndices.GetData()+Offset, NeighbourOffsets[PointIndex+1]-Offset);
+}
+
+FORCEINLINE TArrayView<const int32> UDelaunatorObject::GetPointNeighboursView(int32 PointIndex, TArray<int32>& OutScratch) const
+{
+    if (HasNeighbourCache())
+    {
+        return GetPointNeighboursView(PointIndex);
+    }
+
+    GetPointNeighbours(OutScratch, PointIndex);
+    return OutScratch;
+}
+
+FORCEINLINE int32 UDelaunatorObject::FindPointGridCell(const FVector2D& Point) const
+{
+    const FVector2D Local((Point-PointGridOrigin) * PointGridScale);
+    const int32 X = FMath::Clamp(FMath::FloorToInt(Local.X), 0, PointGridDimension.X-1);
+    const int32 Y = FMath::Clamp(FMath::FloorToInt(Local.Y), 0, PointGridDimension.Y-1);
+    return X + Y*PointGridDimension.X;
+}
+
+FORCEINLINE int32 UDelaunatorObject::GetAllocationCount() const
+{
+    return static_cast<int32>(Delaunator.allocation_count);
+}
+
+FORCEINLINE bool UDelaunatorObject::IsConstrainedEdge(int32 HalfEdgeIndex) const
+{
+    return Delaunator.halfedges.IsValidIndex(HalfEdgeIndex)
+        && Delaunator.is_constrained(HalfEdgeIndex);
 }
 
 FORCEINLINE int32 UDelaunatorObject::GetPointCount() const
 {
-    return Points.Num();
+    return GetPoints().Num();
 }
 
 FORCEINLINE int32 UDelaunatorObject::GetIndexCount() const
@@ -326,7 +643,7 @@ FORCEINLINE int32 UDelaunatorObject::GetTriangleCount() const
 
 FORCEINLINE const TArray<FVector2D>& UDelaunatorObject::GetPoints() const
 {
-    return Points;
+    return SharedPoints.IsValid() ? *SharedPoints : Points;
 }
 
 FORCEINLINE const TArray<int32>& UDelaunatorObject::GetTriangles() const
@@ -398,9 +715,12 @@ inline void UDelaunatorObject::GetTriangleIndicesFlat(TArray<int32>& OutIndices,
 
 FORCEINLINE int32 UDelaunatorObject::GetTrianglePointIndex(int32 InPointIndex) const
 {
-    return (IsValidDelaunatorObject() && Points.IsValidIndex(InPointIndex))
-        ? GetTriangles()[GetHalfEdges()[GetInedges()[InPointIndex]]]
+    // -1 for removed points and for hull points, whose incoming halfedge has no twin
+    const int32 e = (IsValidDelaunatorObject() && IsTriangulatedPoint(InPointIndex))
+        ? GetHalfEdges()[GetInedges()[InPointIndex]]
         : -1;
+
+    return (e >= 0) ? GetTriangles()[e] : -1;
 }
 
 FORCEINLINE_DEBUGGABLE void UDelaunatorObject::GetPointNeighbours(TArray<FVector2D>& OutPoints, int32 PointIndex) const
@@ -412,7 +732,7 @@ FORCEINLINE_DEBUGGABLE void UDelaunatorObject::GetPointNeighbours(TArray<FVector
 
     for (int32 i=0; i<NeighbourIndices.Num(); ++i)
     {
-        OutPoints[i] = Points[NeighbourIndices[i]];
+        OutPoints[i] = GetPoints()[NeighbourIndices[i]];
     }
 }
 
@@ -424,7 +744,7 @@ FORCEINLINE_DEBUGGABLE void UDelaunatorObject::GetPointNeighbours(TArray<int32>&
 
     for (int32 i=0; i<OutNeighbourIndices.Num(); ++i)
     {
-        OutPoints[i] = Points[OutNeighbourIndices[i]];
+        OutPoints[i] = GetPoints()[OutNeighbourIndices[i]];
     }
 }
 
@@ -578,9 +898,9 @@ inline void UDelaunatorObject::GetTriangleCenters(TArray<FVector2D>& OutTriangle
 
         if (InTriangles.IsValidIndex(i))
         {
-            const FVector2D& P0(Points[InTriangles[i  ]]);
-            const FVector2D& P1(Points[InTriangles[i+1]]);
-            const FVector2D& P2(Points[InTriangles[i+2]]);
+            const FVector2D& P0(GetPoints()[InTriangles[i  ]]);
+            const FVector2D& P1(GetPoints()[InTriangles[i+1]]);
+            const FVector2D& P2(GetPoints()[InTriangles[i+2]]);
             OutTriangleCenters.Emplace((P0+P1+P2)/3.f);
         }
     }
@@ -603,9 +923,9 @@ inline void UDelaunatorObject::GetTriangleCircumcenters(TArray<FVector2D>& OutTr
 
         if (InTriangles.IsValidIndex(i))
         {
-            const FVector2D& P0(Points[InTriangles[i  ]]);
-            const FVector2D& P1(Points[InTriangles[i+1]]);
-            const FVector2D& P2(Points[InTriangles[i+2]]);
+            const FVector2D& P0(GetPoints()[InTriangles[i  ]]);
+            const FVector2D& P1(GetPoints()[InTriangles[i+1]]);
+            const FVector2D& P2(GetPoints()[InTriangles[i+2]]);
 
             const FVector2D P01 = P1 - P0;
             const FVector2D P02 = P2 - P0;
@@ -622,6 +942,11 @@ inline void UDelaunatorObject::GetTriangleCircumcenters(TArray<FVector2D>& OutTr
     }
 }
 
+FORCEINLINE bool UDelaunatorObject::IsTriangulatedPoint(int32 PointIndex) const
+{
+    return Inedges.IsValidIndex(PointIndex) && Inedges[PointIndex] >= 0;
+}
+
 FORCEINLINE const TArray<FVector2D>& UDelaunatorObject::K2_GetPoints()
 {
     return GetPoints();
@@ -710,6 +1035,18 @@ FORCEINLINE int32 UDelaunatorObject::K2_FindPoint(const FVector2D& TargetPoint,
     return FindPoint(TargetPoint, InitialPoint);
 }
 
+inline void UDelaunatorObject::K2_FindPoints(TArray<int32>& OutPointIndices, const TArray<FVector2D>& InTargetPoints)
+{
+    OutPointIndices.SetNumUninitialized(InTargetPoints.Num());
+    FindPoints(InTargetPoints, OutPointIndices);
+}
+
+inline void UDelaunatorObject::K2_InterpolateValues(TArray<float>& OutValues, UDelaunatorValueObject* ValueObject, const TArray<FVector2D>& InPositions)
+{
+    OutValues.SetNumUninitialized(InPositions.Num());
+    InterpolateValues(ValueObject, InPositions, OutValues);
+}
+
 inline void UDelaunatorObject::K2_GetTriangleIndices(TArray<int32>& OutIndices, const TArray<int32>& InFilterTriangles)
 {
     OutIndices.Reset(InFilterTriangles.Num()*3);
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Streamed mesh file layout: header, triangle records, page table
+
+struct FDelaunatorStreamHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    int64 PointCount;
+    int64 TriangleCount;
+    int64 PageTableOffset;
+    int32 PageTriangleCount;
+    int32 PageCount;
+};
+
+struct FDelaunatorStreamTriangle
+{
+    int32 Points[3];
+
+    // Global halfedge of each edge twin, -1 on the hull
+    int32 HalfEdges[3];
+};
+
+struct FDelaunatorStreamPage
+{
+    // Point index range referenced by the page triangles
+    int32 MinPoint;
+    int32 MaxPoint;
+};
+
+struct DELAUNATORPLUGIN_API FDelaunatorStreamTriangulator
+{
+    static const uint32 FileMagic = 0x534E4C44;
+    static const uint32 FileVersion = 1;
+
+    // Global halfedge ids are int32, n points give less than 2n triangles
+    static const int64 MaxPointCount = MAX_int32 / 6;
+
+    // Sort points along X and write them as a packed FVector2D point file
+    static bool WritePointFile(const FString& Filename, TArray<FVector2D>& InOutPoints);
+
+    // Triangulate a point file sorted along X in chunks of ChunkPointCount
+    // points, memory use follows the sweep front instead of the point count.
+    // A triangle is written once its circumcircle lies behind the next chunk.
+    // Fails on point files larger than MaxPointCount.
+    static bool Triangulate(
+        const FString& PointFile,
+        const FString& MeshFile,
+        int32 ChunkPointCount = 1 << 20,
+        int32 PageTriangleCount = 1 << 16,
+        bool bRobustPredicates = false
+        );
+};
+
+// Paged read access to a streamed triangulation, triangle pages are mapped
+// on demand and the least recently used page is unmapped past MaxResidentPages
+class DELAUNATORPLUGIN_API FDelaunatorStreamMesh
+{
+public:
+
+    FDelaunatorStreamMesh();
+    ~FDelaunatorStreamMesh();
+
+    bool Open(const FString& PointFile, const FString& MeshFile, int32 InMaxResidentPages = 16);
+    void Close();
+
+    FORCEINLINE bool IsOpen() const
+    {
+        return PointData != nullptr;
+    }
+
+    FORCEINLINE int32 GetPointCount() const
+    {
+        return static_cast<int32>(Header.PointCount);
+    }
+
+    FORCEINLINE int32 GetTriangleCount() const
+    {
+        return static_cast<int32>(Header.TriangleCount);
+    }
+
+    FORCEINLINE int32 GetPageCount() const
+    {
+        return Pages.Num();
+    }
+
+    FORCEINLINE int32 GetPageTriangleCount() const
+    {
+        return Header.PageTriangleCount;
+    }
+
+    FORCEINLINE const FDelaunatorStreamPage& GetPageInfo(int32 PageIndex) const
+    {
+        return Pages[PageIndex];
+    }
+
+    FORCEINLINE const FVector2D& GetPoint(int32 PointIndex) const
+    {
+        return PointData[PointIndex];
+    }
+
+    // Triangles of a page, valid until the page is evicted
+    TArrayView<const FDelaunatorStreamTriangle> GetPage(int32 PageIndex);
+
+    // Point index range [OutFirst, OutLast) with X within [MinX, MaxX]
+    void FindPointRange(float MinX, float MaxX, int32& OutFirst, int32& OutLast) const;
+
+private:
+
+    struct FResidentPage
+    {
+        int32 PageIndex;
+        uint64 LastUse;
+        TUniquePtr<IMappedFileRegion> Region;
+    };
+
+    TUniquePtr<IMappedFileHandle> PointHandle;
+    TUniquePtr<IMappedFileRegion> PointRegion;
+    TUniquePtr<IMappedFileHandle> MeshHandle;
+
+    const FVector2D* PointData;
+    FDelaunatorStreamHeader Header;
+    TArray<FDelaunatorStreamPage> Pages;
+
+    TArray<FResidentPage> ResidentPages;
+    int32 MaxResidentPages;
+    uint64 UseCounter;
+};
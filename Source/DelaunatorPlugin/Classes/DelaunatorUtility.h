@@ -49,6 +49,20 @@ public:
     UFUNCTION(BlueprintCallable, Category="Delaunator")
     static void GenerateDelaunatorIndices(TArray<int32>& OutTriangles, TArray<int32>& OutHalfEdges, const TArray<FVector2D>& InPoints);
 
+    // Triangulate independent point chunks in parallel. Chunk i spans points
+    // [InChunkOffsets[i], InChunkOffsets[i+1]) with the last chunk ending at
+    // InPoints.Num(). Triangles index into InPoints, half edges index into
+    // the shared output buffer, chunk i occupies
+    // [OutChunkIndexOffsets[i], OutChunkIndexOffsets[i+1]).
+    UFUNCTION(BlueprintCallable, Category="Delaunator")
+    static void GenerateDelaunatorIndicesBatch(
+        TArray<int32>& OutTriangles,
+        TArray<int32>& OutHalfEdges,
+        TArray<int32>& OutChunkIndexOffsets,
+        const TArray<FVector2D>& InPoints,
+        const TArray<int32>& InChunkOffsets
+        );
+
     UFUNCTION(BlueprintCallable, Category="Delaunator")
     static void GenerateJitteredGridPoints(
         TArray<FVector2D>& OutPoints,
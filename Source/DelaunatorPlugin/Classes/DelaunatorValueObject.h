@@ -98,6 +98,18 @@ public:
         }
 
     }
+
+    // Reorder values, value i is taken from InOrder[i]
+
+    FORCEINLINE void ReorderValues(const TArray<int32>& InOrder)
+    {
+        const ContainerType SourceValues(Values);
+
+        for (int32 i=0; i<InOrder.Num(); ++i)
+        {
+            Values[i] = SourceValues[InOrder[i]];
+        }
+    }
 };
 
 UCLASS(BlueprintType, Abstract)
@@ -130,6 +142,12 @@ public:
         // Blank Implementation
     }
 
+    // Reorder element values, new element i takes old element InOrder[i]
+    FORCEINLINE virtual void RemapValues(const TArray<int32>& InOrder)
+    {
+        // Blank Implementation
+    }
+
     FORCEINLINE virtual bool IsValidElementCount(int32 InElementCount) const
     {
         return GetElementCount() == InElementCount;
@@ -259,6 +277,11 @@ public:
         SetValues(ValueCount);
     }
 
+    FORCEINLINE virtual void RemapValues(const TArray<int32>& InOrder) override
+    {
+        ReorderValues(InOrder);
+    }
+
     FORCEINLINE virtual int32 GetElementCount() const override
     {
         return Values.Num();
@@ -308,6 +331,11 @@ public:
         SetValues(ValueCount);
     }
 
+    FORCEINLINE virtual void RemapValues(const TArray<int32>& InOrder) override
+    {
+        ReorderValues(InOrder);
+    }
+
     FORCEINLINE virtual int32 GetElementCount() const override
     {
         return Values.Num();
@@ -357,6 +385,11 @@ public:
         SetValues(ValueCount);
     }
 
+    FORCEINLINE virtual void RemapValues(const TArray<int32>& InOrder) override
+    {
+        ReorderValues(InOrder);
+    }
+
     FORCEINLINE virtual int32 GetElementCount() const override
     {
         return Values.Num();
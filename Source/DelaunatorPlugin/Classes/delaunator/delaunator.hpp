@@ -11,19 +11,47 @@
 namespace delaunator
 {
 
-typedef float FReal;
 typedef int32 FIndex;
 
 constexpr FIndex INVALID_INDEX =
     //(std::numeric_limits<FIndex>::max)();
     -1;
 
-constexpr FReal EPSILON = KINDA_SMALL_NUMBER;
+// index arrays of an index type, int64 indices use a 64-bit sized allocator
+// so triangulations past 2^31 halfedges fit in a single array
+template<typename FIndex>
+struct index_allocator
+{
+    typedef FDefaultAllocator type;
+};
+
+template<>
+struct index_allocator<int64>
+{
+    typedef FDefaultAllocator64 type;
+};
+
+template<typename FIndex>
+using TIndexArray = TArray<FIndex, typename index_allocator<FIndex>::type>;
+
+constexpr float EPSILON = KINDA_SMALL_NUMBER;
 
+// Minimum number of points per slab for the parallel triangulation,
+// smaller slabs make the serial seam pass dominate
+constexpr FIndex PARALLEL_MIN_SLAB_SIZE = 1 << 14;
+
+// Digit size of the sweep order radix sort
+constexpr int32 SORT_RADIX_BITS = 11;
+
+// Points per worker chunk of the pre-sort seed and sort key scans
+constexpr FIndex SCAN_CHUNK_SIZE = 1 << 16;
+
+template<typename FReal>
 FReal sum(const TArray<FReal>& x);
 
 FIndex fast_mod(const FIndex i, const FIndex c);
 
+template<typename FReal>
 FReal dist(
     const FReal ax,
     const FReal ay,
@@ -31,6 +59,7 @@ FReal dist(
     const FReal by
     );
 
+template<typename FReal>
 bool orient(
     const FReal px,
     const FReal py,
@@ -40,6 +69,7 @@ bool orient(
     const FReal ry
     );
 
+template<typename FReal>
 FReal circumradius(
     const FReal ax,
     const FReal ay,
@@ -49,6 +79,7 @@ FReal circumradius(
     const FReal cy
     );
 
+template<typename FReal>
 void circumcenter(
     FReal& centerx,
     FReal& centery,
@@ -60,6 +91,7 @@ void circumcenter(
     const FReal cy
     );
 
+template<typename FReal>
 bool in_circle(
     const FReal ax,
     const FReal ay,
@@ -71,10 +103,83 @@ bool in_circle(
     const FReal py
     );
 
+// adaptive precision predicates, error bounded double precision filter
+// with exact expansion arithmetic fallback when the sign is uncertain
+
+constexpr double PREDICATE_EPSILON = 1.1102230246251565e-16; // 2^-53
+constexpr double ORIENT_ERRBOUND = (3.0 + 16.0 * PREDICATE_EPSILON) * PREDICATE_EPSILON;
+constexpr double IN_CIRCLE_ERRBOUND = (10.0 + 96.0 * PREDICATE_EPSILON) * PREDICATE_EPSILON;
+
+double orient_exact(
+    const double px,
+    const double py,
+    const double qx,
+    const double qy,
+    const double rx,
+    const double ry
+    );
+
+double in_circle_exact(
+    const double ax,
+    const double ay,
+    const double bx,
+    const double by,
+    const double cx,
+    const double cy,
+    const double px,
+    const double py
+    );
+
+template<typename FReal>
+bool orient_robust(
+    const FReal px,
+    const FReal py,
+    const FReal qx,
+    const FReal qy,
+    const FReal rx,
+    const FReal ry
+    );
+
+template<typename FReal>
+bool in_circle_robust(
+    const FReal ax,
+    const FReal ay,
+    const FReal bx,
+    const FReal by,
+    const FReal cx,
+    const FReal cy,
+    const FReal px,
+    const FReal py
+    );
+
+// unsigned integer of the coordinate width, used as radix sort key
+template<typename FReal>
+struct sort_key;
+
+template<>
+struct sort_key<float>
+{
+    typedef uint32 type;
+};
+
+template<>
+struct sort_key<double>
+{
+    typedef uint64 type;
+};
+
+template<typename FReal>
 bool check_pts_equal(FReal x1, FReal y1, FReal x2, FReal y2);
 
+template<typename FReal>
 FReal pseudo_angle(const FReal dx, const FReal dy);
 
+// point order along a hilbert curve over the point bounds,
+// out_order[new index] = old index
+template<typename FReal, typename FIndex>
+void hilbert_order(const TArrayView<const FReal>& coords, TIndexArray<FIndex>& out_order);
+
+template<typename FReal>
 struct compare
 {
     TArrayView<const FReal> coords;
@@ -89,34 +194,111 @@ struct compare
     bool operator()(FIndex i, FIndex j) const;
 };
 
-class Delaunator
+// triangulator over interleaved float or double coordinates, FIndex is the
+// point and halfedge index type. int32 indices hold about 357M points,
+// int64 indices are bound by the int32 sized coordinate view instead
+template<typename FReal, typename FIndex = int32>
+class TDelaunator
 {
 
 public:
+    typedef typename sort_key<FReal>::type FSortKey;
+
     TArrayView<const FReal> coords;
 
-    TArray<FIndex> triangles;
-    TArray<FIndex> halfedges;
-    TArray<FIndex> hull_prev;
-    TArray<FIndex> hull_next;
-    TArray<FIndex> hull_tri;
+    TIndexArray<FIndex> triangles;
+    TIndexArray<FIndex> halfedges;
+    TIndexArray<FIndex> hull_prev;
+    TIndexArray<FIndex> hull_next;
+    TIndexArray<FIndex> hull_tri;
     FIndex hull_start;
     FIndex hull_size;
 
-    INLINE Delaunator();
-    INLINE Delaunator(const FReal* in_coords, FIndex in_coords_num);
+    // triangles modified by the last insert() and whether it changed the hull
+    TIndexArray<FIndex> touched;
+    bool hull_touched;
+
+    // per-halfedge constrained edge flags, empty without constraints
+    TBitArray<> constrained;
+
+    // use adaptive exact predicates instead of plain float expressions
+    bool robust_predicates;
+
+    // keep triangle and workspace capacity across update() calls
+    bool retain_capacity;
+
+    // number of workspace buffer growths made by update(),
+    // stays constant across steady-state updates with retain_capacity
+    uint32 allocation_count;
+
+    // hot path counters for profiling, accumulated until reset by the caller.
+    // legalize() flips, hull hash probes and hull walk steps
+    uint32 flip_count;
+    uint32 hash_probe_count;
+    uint32 hull_step_count;
+
+    // whether a triangulation of point_count points fits the index type
+    static bool fits(int64 point_count);
+
+    INLINE TDelaunator();
+    INLINE TDelaunator(const FReal* in_coords, FIndex in_coords_num, bool in_robust_predicates = false);
+    // empty triangulation for less than 3 points or collinear points
     INLINE void update();
-    void update(const TArray<FVector2D>& InPoints);
+    void update_parallel(FIndex slab_count = 0);
+
+    // triangulate vector arrays in place, vector components must be FReal
+    template<typename FVectorType>
+    void update(const TArray<FVectorType>& points);
+    template<typename FVectorType>
+    void update_parallel(const TArray<FVectorType>& points, FIndex slab_count = 0);
+    FIndex insert(FIndex i, FIndex start = 0);
+    FIndex locate(FReal x, FReal y, FIndex start, bool& out_outside) const;
+    bool remove(FIndex i, FIndex e);
+    bool check_star(FIndex e, FReal x, FReal y) const;
+    void flip_star(FIndex e);
+    bool constrain(FIndex a, FIndex e, FIndex b);
+    bool is_constrained(FIndex e) const;
+    void get_region_depths(TIndexArray<FIndex>& out_depths) const;
+
+    // renumber points by point_order (new index to old index) and sort
+    // triangles along the new point order, coords must be rebound to the
+    // reordered points by the caller
+    void renumber(const TIndexArray<FIndex>& point_order);
+
+    // take an externally built triangulation of coords, hull links are
+    // traced from edges without a twin. Point location and incremental
+    // updates require the boundary to be one convex loop
+    void assign(TIndexArray<FIndex>&& in_triangles, TIndexArray<FIndex>&& in_halfedges);
     FReal get_hull_area() const;
 
 private:
-    TArray<FIndex> m_hash;
+    TIndexArray<FIndex> m_ids;
+    TIndexArray<FIndex> m_hash;
     FReal m_centerx;
     FReal m_centery;
     FIndex m_hash_size;
-    TArray<FIndex> m_edge_stack;
+    TIndexArray<FIndex> m_edge_stack;
+    TIndexArray<FIndex> m_flip_stack;
+    TIndexArray<FIndex> m_star;
+    TIndexArray<FIndex> m_fill;
+    bool m_record_touched;
+
+    // radix sort scratch buffers, kept across updates
+    TArray<FSortKey> m_sort_keys;
+    TArray<FSortKey> m_sort_keys_tmp;
+    TIndexArray<FIndex> m_sort_ids_tmp;
+    TArray<uint32> m_sort_histograms;
+
+    // per chunk results of the pre-sort scans
+    TArray<FReal> m_scan_values;
+    TIndexArray<FIndex> m_scan_indices;
 
     FIndex hash_key(FReal x, FReal y) const;
+
+    // predicates selected by robust_predicates
+    bool orient(FReal px, FReal py, FReal qx, FReal qy, FReal rx, FReal ry) const;
+    bool in_circle(FReal ax, FReal ay, FReal bx, FReal by, FReal cx, FReal cy, FReal px, FReal py) const;
+
     void link(FIndex a, FIndex b);
     FIndex add_triangle(
         FIndex i0,
@@ -127,6 +309,39 @@ private:
         FIndex c);
 
     INLINE FIndex legalize(FIndex a);
+
+    void sort_ids(TIndexArray<FIndex>& ids);
+
+    void scan_bounds_chunks(FIndex n, FReal& min_x, FReal& min_y, FReal& max_x, FReal& max_y);
+    template<typename FScan>
+    FIndex scan_min_chunks(FIndex n, FReal& out_min, FScan scan);
+
+    template<typename T, typename FAllocator>
+    void reserve_workspace(TArray<T, FAllocator>& buffer, FIndex num, bool reset = false);
+
+    template<typename FVectorType>
+    static TArrayView<const FReal> get_vector_coords(const TArray<FVectorType>& points);
+
+    bool update_slabs(FIndex slab_count);
+    void reset_triangulation();
+
+    void set_constrained(FIndex e, bool value);
+    void move_constrained(FIndex src, FIndex dst);
+
+    FIndex insert_hull(FIndex i, FIndex e);
+    FIndex split_triangle(FIndex i, FIndex t);
+    FIndex split_edge(FIndex i, FIndex e);
+    bool gather_star(FIndex i, FIndex e);
+    bool clip_polygon(
+        const TIndexArray<FIndex>& poly_v,
+        TIndexArray<FIndex>& poly_h,
+        const TIndexArray<FIndex>& slots,
+        FIndex& fill_count);
+    void write_fill(const TIndexArray<FIndex>& slots, FIndex first, FIndex count, bool closed);
+    FIndex find_fill_edge(FIndex first, FIndex count, FIndex a, FIndex b) const;
+    bool insert_segment(FIndex a, FIndex e, FIndex b);
+    void flip_edges();
+    void move_triangle(FIndex src, FIndex dst);
 };
 
 } //namespace delaunator
@@ -135,6 +350,7 @@ namespace delaunator
 {
 
 // Kahan and Babuska summation, Neumaier variant; accumulates less FP error
+template<typename FReal>
 inline FReal sum(const TArray<FReal>& x)
 {
     FReal sum = x[0];
@@ -156,6 +372,7 @@ FORCEINLINE FIndex fast_mod(const FIndex i, const FIndex c)
     return i >= c ? i % c : i;
 }
 
+template<typename FReal>
 FORCEINLINE FReal dist(
     const FReal ax,
     const FReal ay,
@@ -168,6 +385,7 @@ FORCEINLINE FReal dist(
     return dx * dx + dy * dy;
 }
 
+template<typename FReal>
 FORCEINLINE bool orient(
     const FReal px,
     const FReal py,
@@ -180,6 +398,7 @@ FORCEINLINE bool orient(
     return (qy - py) * (rx - qx) - (qx - px) * (ry - qy) < 0.0;
 }
 
+template<typename FReal>
 FORCEINLINE FReal circumradius(
     const FReal ax,
     const FReal ay,
@@ -211,6 +430,7 @@ FORCEINLINE FReal circumradius(
     }
 }
 
+template<typename FReal>
 FORCEINLINE void circumcenter(
     FReal& centerx,
     FReal& centery,
@@ -238,6 +458,7 @@ FORCEINLINE void circumcenter(
     centery = y;
 }
 
+template<typename FReal>
 FORCEINLINE bool in_circle(
     const FReal ax,
     const FReal ay,
@@ -265,6 +486,107 @@ FORCEINLINE bool in_circle(
             ap * (ex * fy - ey * fx)) < 0.0;
 }
 
+template<typename FReal>
+FORCEINLINE bool orient_robust(
+    const FReal px,
+    const FReal py,
+    const FReal qx,
+    const FReal qy,
+    const FReal rx,
+    const FReal ry
+    )
+{
+    // same sign convention as orient(), true for counter-clockwise [p, q, r]
+    const double detleft = (double(px) - rx) * (double(qy) - ry);
+    const double detright = (double(py) - ry) * (double(qx) - rx);
+    const double det = detleft - detright;
+
+    double detsum;
+
+    if (detleft > 0.0)
+    {
+        if (detright <= 0.0)
+        {
+            return det > 0.0;
+        }
+        detsum = detleft + detright;
+    }
+    else
+    if (detleft < 0.0)
+    {
+        if (detright >= 0.0)
+        {
+            return det > 0.0;
+        }
+        detsum = -detleft - detright;
+    }
+    else
+    {
+        return det > 0.0;
+    }
+
+    const double errbound = ORIENT_ERRBOUND * detsum;
+
+    if (det > errbound || -det > errbound)
+    {
+        return det > 0.0;
+    }
+
+    return orient_exact(px, py, qx, qy, rx, ry) > 0.0;
+}
+
+template<typename FReal>
+FORCEINLINE bool in_circle_robust(
+    const FReal ax,
+    const FReal ay,
+    const FReal bx,
+    const FReal by,
+    const FReal cx,
+    const FReal cy,
+    const FReal px,
+    const FReal py
+    )
+{
+    const double adx = double(ax) - px;
+    const double ady = double(ay) - py;
+    const double bdx = double(bx) - px;
+    const double bdy = double(by) - py;
+    const double cdx = double(cx) - px;
+    const double cdy = double(cy) - py;
+
+    const double bdxcdy = bdx * cdy;
+    const double cdxbdy = cdx * bdy;
+    const double alift = adx * adx + ady * ady;
+
+    const double cdxady = cdx * ady;
+    const double adxcdy = adx * cdy;
+    const double blift = bdx * bdx + bdy * bdy;
+
+    const double adxbdy = adx * bdy;
+    const double bdxady = bdx * ady;
+    const double clift = cdx * cdx + cdy * cdy;
+
+    const double det =
+        alift * (bdxcdy - cdxbdy) +
+        blift * (cdxady - adxcdy) +
+        clift * (adxbdy - bdxady);
+
+    const double permanent =
+        (FMath::Abs(bdxcdy) + FMath::Abs(cdxbdy)) * alift +
+        (FMath::Abs(cdxady) + FMath::Abs(adxcdy)) * blift +
+        (FMath::Abs(adxbdy) + FMath::Abs(bdxady)) * clift;
+
+    const double errbound = IN_CIRCLE_ERRBOUND * permanent;
+
+    if (det > errbound || -det > errbound)
+    {
+        return det < 0.0;
+    }
+
+    return in_circle_exact(ax, ay, bx, by, cx, cy, px, py) < 0.0;
+}
+
+template<typename FReal>
 FORCEINLINE bool check_pts_equal(FReal x1, FReal y1, FReal x2, FReal y2)
 {
     return FMath::Abs(x1 - x2) <= EPSILON &&
@@ -273,13 +595,15 @@ FORCEINLINE bool check_pts_equal(FReal x1, FReal y1, FReal x2, FReal y2)
 
 // monotonically increases with real angle,
 // but doesn't need expensive trigonometry
+template<typename FReal>
 inline FReal pseudo_angle(const FReal dx, const FReal dy)
 {
     const FReal p = dx / (FMath::Abs(dx) + FMath::Abs(dy));
     return (dy > 0.0 ? 3.0 - p : 1.0 + p) / 4.0; // [0..1)
 }
 
-inline compare::compare(
+template<typename FReal>
+inline compare<FReal>::compare(
     const TArrayView<const FReal>& in_coords,
     FReal centerx,
     FReal centery
@@ -298,7 +622,8 @@ inline compare::compare(
     }
 }
 
-FORCEINLINE bool compare::operator()(FIndex i, FIndex j) const
+template<typename FReal>
+FORCEINLINE bool compare<FReal>::operator()(FIndex i, FIndex j) const
 {
     const FReal diff1 = dists[i] - dists[j];
     const FReal diff2 = coords[2 * i] - coords[2 * j];
@@ -320,7 +645,14 @@ FORCEINLINE bool compare::operator()(FIndex i, FIndex j) const
     }
 }
 
-inline FReal Delaunator::get_hull_area() const
+template<typename FReal, typename FIndex>
+FORCEINLINE bool TDelaunator<FReal, FIndex>::fits(int64 point_count)
+{
+    return point_count < 3 || 3 * (2 * point_count - 5) <= TNumericLimits<FIndex>::Max();
+}
+
+template<typename FReal, typename FIndex>
+inline FReal TDelaunator<FReal, FIndex>::get_hull_area() const
 {
     TArray<FReal> hull_area;
     FIndex e = hull_start;
@@ -335,17 +667,51 @@ inline FReal Delaunator::get_hull_area() const
     return sum(hull_area);
 }
 
-FORCEINLINE FIndex Delaunator::hash_key(const FReal x, const FReal y) const
+template<typename FReal, typename FIndex>
+FORCEINLINE FIndex TDelaunator<FReal, FIndex>::hash_key(const FReal x, const FReal y) const
 {
     const FReal dx = x - m_centerx;
     const FReal dy = y - m_centery;
     return fast_mod(
-        FMath::FloorToInt(pseudo_angle(dx, dy) * static_cast<FReal>(m_hash_size)),
+        FMath::FloorToInt(static_cast<float>(pseudo_angle(dx, dy) * static_cast<FReal>(m_hash_size))),
         m_hash_size
         );
 }
 
-FORCEINLINE void Delaunator::link(const FIndex a, const FIndex b)
+template<typename FReal, typename FIndex>
+FORCEINLINE bool TDelaunator<FReal, FIndex>::orient(
+    const FReal px,
+    const FReal py,
+    const FReal qx,
+    const FReal qy,
+    const FReal rx,
+    const FReal ry
+    ) const
+{
+    return robust_predicates
+        ? orient_robust(px, py, qx, qy, rx, ry)
+        : delaunator::orient(px, py, qx, qy, rx, ry);
+}
+
+template<typename FReal, typename FIndex>
+FORCEINLINE bool TDelaunator<FReal, FIndex>::in_circle(
+    const FReal ax,
+    const FReal ay,
+    const FReal bx,
+    const FReal by,
+    const FReal cx,
+    const FReal cy,
+    const FReal px,
+    const FReal py
+    ) const
+{
+    return robust_predicates
+        ? in_circle_robust(ax, ay, bx, by, cx, cy, px, py)
+        : delaunator::in_circle(ax, ay, bx, by, cx, cy, px, py);
+}
+
+template<typename FReal, typename FIndex>
+FORCEINLINE void TDelaunator<FReal, FIndex>::link(const FIndex a, const FIndex b)
 {
     FIndex s = halfedges.Num();
 
@@ -383,7 +749,37 @@ FORCEINLINE void Delaunator::link(const FIndex a, const FIndex b)
     }
 }
 
-FORCEINLINE FIndex Delaunator::add_triangle(
+template<typename FReal, typename FIndex>
+FORCEINLINE bool TDelaunator<FReal, FIndex>::is_constrained(FIndex e) const
+{
+    return constrained.Num() > 0 && constrained[e];
+}
+
+template<typename FReal, typename FIndex>
+FORCEINLINE void TDelaunator<FReal, FIndex>::set_constrained(FIndex e, bool value)
+{
+    constrained[e] = value;
+
+    if (halfedges[e] != INVALID_INDEX)
+    {
+        constrained[halfedges[e]] = value;
+    }
+}
+
+// move edge constraint flag to another slot, used when flips rotate edges
+template<typename FReal, typename FIndex>
+FORCEINLINE void TDelaunator<FReal, FIndex>::move_constrained(FIndex src, FIndex dst)
+{
+    if (constrained.Num() > 0)
+    {
+        const bool value = constrained[src];
+        constrained[src] = false;
+        constrained[dst] = value;
+    }
+}
+
+template<typename FReal, typename FIndex>
+FORCEINLINE FIndex TDelaunator<FReal, FIndex>::add_triangle(
     FIndex i0,
     FIndex i1,
     FIndex i2,
@@ -399,9 +795,206 @@ FORCEINLINE FIndex Delaunator::add_triangle(
     link(t, a);
     link(t + 1, b);
     link(t + 2, c);
+
+    if (constrained.Num() > 0)
+    {
+        constrained.Add(false);
+        constrained.Add(false);
+        constrained.Add(false);
+    }
+
     return t;
 }
 
+template<typename FReal, typename FIndex>
+template<typename T, typename FAllocator>
+FORCEINLINE void TDelaunator<FReal, FIndex>::reserve_workspace(TArray<T, FAllocator>& buffer, FIndex num, bool reset)
+{
+    if (buffer.Max() < num)
+    {
+        ++allocation_count;
+    }
+
+    if (reset)
+    {
+        buffer.Reset(num);
+    }
+    else
+    {
+        buffer.SetNumUninitialized(num, false);
+    }
+}
+
+template<typename FReal, typename FIndex>
+template<typename FVectorType>
+FORCEINLINE TArrayView<const FReal> TDelaunator<FReal, FIndex>::get_vector_coords(const TArray<FVectorType>& points)
+{
+    static_assert(
+        TIsSame<decltype(FVectorType::X), FReal>::Value && sizeof(FVectorType) == 2 * sizeof(FReal),
+        "Vector components must match the triangulation coordinate type"
+        );
+
+    return points.Num() > 0
+        ? MakeArrayView(&points.GetData()->X, points.Num() * 2)
+        : TArrayView<const FReal>();
+}
+
+template<typename FReal, typename FIndex>
+template<typename FVectorType>
+inline void TDelaunator<FReal, FIndex>::update(const TArray<FVectorType>& points)
+{
+    // less than 3 points resets to an empty triangulation
+    coords = get_vector_coords(points);
+    update();
+}
+
+template<typename FReal, typename FIndex>
+template<typename FVectorType>
+inline void TDelaunator<FReal, FIndex>::update_parallel(const TArray<FVectorType>& points, FIndex slab_count)
+{
+    coords = get_vector_coords(points);
+    update_parallel(slab_count);
+}
+
+typedef TDelaunator<float> DelaunatorFloat;
+typedef TDelaunator<double> DelaunatorDouble;
+
+typedef TDelaunator<float, int64> DelaunatorFloat64;
+typedef TDelaunator<double, int64> DelaunatorDouble64;
+
+// default triangulator matching FVector2D component precision
+typedef TDelaunator<decltype(FVector2D::X)> Delaunator;
+typedef TDelaunator<decltype(FVector2D::X), int64> Delaunator64;
+
+// narrowed copy of a finished triangulation for resident storage, the
+// max value of each index type is the invalid index. halfedge ids reach
+// three times the triangle count, uint16 edges hold about 10.9k points
+template<typename FPointIndex, typename FEdgeIndex = FPointIndex>
+class TCompactMesh
+{
+public:
+
+    static constexpr FPointIndex INVALID_POINT = TNumericLimits<FPointIndex>::Max();
+    static constexpr FEdgeIndex INVALID_EDGE = TNumericLimits<FEdgeIndex>::Max();
+
+    TArray<FPointIndex> triangles;
+    TArray<FEdgeIndex> halfedges;
+    TArray<FEdgeIndex> inedges;
+    TArray<FPointIndex> hull;
+
+    static bool fits(FIndex point_count, FIndex index_count)
+    {
+        return static_cast<uint64>(point_count) < static_cast<uint64>(INVALID_POINT)
+            && static_cast<uint64>(index_count) < static_cast<uint64>(INVALID_EDGE);
+    }
+
+    // narrow triangulation arrays, false if the indices do not fit
+    bool assign(
+        const TArray<FIndex>& in_triangles,
+        const TArray<FIndex>& in_halfedges,
+        const TArray<FIndex>& in_inedges,
+        const TArray<FIndex>& in_hull);
+
+    FIndex get_point_count() const
+    {
+        return inedges.Num();
+    }
+
+    FIndex get_triangle_count() const
+    {
+        return triangles.Num() / 3;
+    }
+
+    SIZE_T get_allocated_size() const
+    {
+        return triangles.GetAllocatedSize()
+            + halfedges.GetAllocatedSize()
+            + inedges.GetAllocatedSize()
+            + hull.GetAllocatedSize();
+    }
+
+    // neighbour points of i, walking triangles around the point
+    void get_neighbours(FIndex i, TArray<FIndex>& out_neighbours) const;
+
+    // widen back to triangulation indices
+    void expand(TArray<FIndex>& out_triangles, TArray<FIndex>& out_halfedges) const;
+
+private:
+
+    template<typename FOut, typename FIn>
+    static void narrow(TArray<FOut>& out, const TArray<FIn>& in, FOut invalid);
+};
+
+template<typename FPointIndex, typename FEdgeIndex>
+template<typename FOut, typename FIn>
+inline void TCompactMesh<FPointIndex, FEdgeIndex>::narrow(TArray<FOut>& out, const TArray<FIn>& in, FOut invalid)
+{
+    out.SetNumUninitialized(in.Num());
+
+    for (FIndex i = 0; i < in.Num(); ++i)
+    {
+        out[i] = in[i] == INVALID_INDEX ? invalid : static_cast<FOut>(in[i]);
+    }
+}
+
+template<typename FPointIndex, typename FEdgeIndex>
+inline bool TCompactMesh<FPointIndex, FEdgeIndex>::assign(
+    const TArray<FIndex>& in_triangles,
+    const TArray<FIndex>& in_halfedges,
+    const TArray<FIndex>& in_inedges,
+    const TArray<FIndex>& in_hull)
+{
+    if (! fits(in_inedges.Num(), in_halfedges.Num()))
+    {
+        return false;
+    }
+
+    narrow(triangles, in_triangles, INVALID_POINT);
+    narrow(halfedges, in_halfedges, INVALID_EDGE);
+    narrow(inedges, in_inedges, INVALID_EDGE);
+    narrow(hull, in_hull, INVALID_POINT);
+
+    return true;
+}
+
+template<typename FPointIndex, typename FEdgeIndex>
+inline void TCompactMesh<FPointIndex, FEdgeIndex>::get_neighbours(FIndex i, TArray<FIndex>& out_neighbours) const
+{
+    out_neighbours.Reset();
+
+    const FEdgeIndex e0 = inedges[i];
+
+    // coincident point
+    if (e0 == INVALID_EDGE)
+    {
+        return;
+    }
+
+    FEdgeIndex e = e0;
+    do
+    {
+        out_neighbours.Emplace(triangles[e]);
+
+        const FIndex f = 3 * (e / 3);
+        e = static_cast<FEdgeIndex>((e - f) < 2 ? e + 1 : f);
+        e = halfedges[e];
+    }
+    while (e != e0 && e != INVALID_EDGE);
+}
+
+template<typename FPointIndex, typename FEdgeIndex>
+inline void TCompactMesh<FPointIndex, FEdgeIndex>::expand(TArray<FIndex>& out_triangles, TArray<FIndex>& out_halfedges) const
+{
+    out_triangles.SetNumUninitialized(triangles.Num());
+    out_halfedges.SetNumUninitialized(halfedges.Num());
+
+    for (FIndex e = 0; e < triangles.Num(); ++e)
+    {
+        out_triangles[e] = triangles[e];
+        out_halfedges[e] = halfedges[e] == INVALID_EDGE ? INVALID_INDEX : halfedges[e];
+    }
+}
+
 }; // namespace delaunator
 
 #undef INLINE
@@ -45,6 +45,7 @@ public class DelaunatorPlugin: ModuleRules
 
         PrivateDependencyModuleNames.AddRange(
             new string[] {
+                "Json"
             });
 
         //string ThirdPartyPath = Path.Combine(ModuleDirectory, "../../ThirdParty");
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "delaunator/delaunator.hpp"
+
+namespace
+{
+
+template<typename FReal>
+double BenchmarkTriangulation(
+    const TArray<FReal>& Coords,
+    int32 Iterations,
+    int32& OutTriangleCount,
+    bool bRobustPredicates = false
+    )
+{
+    delaunator::TDelaunator<FReal> Delaunator;
+    Delaunator.coords = MakeArrayView(Coords);
+    Delaunator.retain_capacity = true;
+    Delaunator.robust_predicates = bRobustPredicates;
+
+    // Warm up workspace
+    Delaunator.update();
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (int32 i=0; i<Iterations; ++i)
+    {
+        Delaunator.update();
+    }
+
+    OutTriangleCount = Delaunator.triangles.Num() / 3;
+
+    return (FPlatformTime::Seconds() - StartTime) / Iterations;
+}
+
+// Delaunator.BenchmarkPrecision [PointCount] [Iterations] [Extent]
+void BenchmarkPrecision(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+    const int32 PointCount = FMath::Max(3, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100000);
+    const int32 Iterations = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10);
+    const double Extent = Args.Num() > 2 ? FCString::Atod(*Args[2]) : 2000000.0;
+
+    // Uniform points over a square map extent, stored at both precisions
+
+    TArray<double> CoordsDouble;
+    TArray<float> CoordsFloat;
+    CoordsDouble.SetNumUninitialized(PointCount*2);
+    CoordsFloat.SetNumUninitialized(PointCount*2);
+
+    FRandomStream Rand(0);
+
+    for (int32 i=0; i<CoordsDouble.Num(); ++i)
+    {
+        CoordsDouble[i] = Rand.GetFraction() * Extent;
+        CoordsFloat[i] = static_cast<float>(CoordsDouble[i]);
+    }
+
+    int32 TriangleCountFloat;
+    int32 TriangleCountDouble;
+
+    const double TimeFloat = BenchmarkTriangulation(CoordsFloat, Iterations, TriangleCountFloat);
+    const double TimeDouble = BenchmarkTriangulation(CoordsDouble, Iterations, TriangleCountDouble);
+
+    Ar.Logf(TEXT("Delaunator precision benchmark: %d points, %d iterations, extent %.0f"), PointCount, Iterations, Extent);
+    Ar.Logf(TEXT("  float : %8.3f ms, %6.2f Mpts/s, %d triangles"), TimeFloat*1000.0, PointCount/TimeFloat*1e-6, TriangleCountFloat);
+    Ar.Logf(TEXT("  double: %8.3f ms, %6.2f Mpts/s, %d triangles"), TimeDouble*1000.0, PointCount/TimeDouble*1e-6, TriangleCountDouble);
+}
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice GDelaunatorBenchmarkPrecisionCommand(
+    TEXT("Delaunator.BenchmarkPrecision"),
+    TEXT("Compare float and double triangulation throughput. Arguments: [PointCount] [Iterations] [Extent]"),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkPrecision)
+    );
+
+// Delaunator.BenchmarkPredicates [PointCount] [Iterations]
+void BenchmarkPredicates(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+    const int32 PointCount = FMath::Max(3, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000);
+    const int32 Iterations = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10);
+
+    // Non-degenerate uniform points, the exact fallback should rarely run
+
+    TArray<float> Coords;
+    Coords.SetNumUninitialized(PointCount*2);
+
+    FRandomStream Rand(0);
+
+    for (int32 i=0; i<Coords.Num(); ++i)
+    {
+        Coords[i] = Rand.GetFraction() * 1000.f;
+    }
+
+    int32 TriangleCountFast;
+    int32 TriangleCountRobust;
+
+    const double TimeFast = BenchmarkTriangulation(Coords, Iterations, TriangleCountFast, false);
+    const double TimeRobust = BenchmarkTriangulation(Coords, Iterations, TriangleCountRobust, true);
+
+    Ar.Logf(TEXT("Delaunator predicate benchmark: %d points, %d iterations"), PointCount, Iterations);
+    Ar.Logf(TEXT("  fast  : %8.3f ms, %6.2f Mpts/s, %d triangles"), TimeFast*1000.0, PointCount/TimeFast*1e-6, TriangleCountFast);
+    Ar.Logf(TEXT("  robust: %8.3f ms, %6.2f Mpts/s, %d triangles"), TimeRobust*1000.0, PointCount/TimeRobust*1e-6, TriangleCountRobust);
+    Ar.Logf(TEXT("  robust overhead: %+.1f%%"), (TimeRobust/TimeFast - 1.0) * 100.0);
+}
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice GDelaunatorBenchmarkPredicatesCommand(
+    TEXT("Delaunator.BenchmarkPredicates"),
+    TEXT("Compare fast and robust predicate triangulation on non-degenerate input. Arguments: [PointCount] [Iterations]"),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkPredicates)
+    );
+
+// Delaunator.BenchmarkElongated [PointCount] [Iterations] [Width]
+void BenchmarkElongated(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+    const int32 PointCount = FMath::Max(3, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200000);
+    const int32 Iterations = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10);
+    const float Width = Args.Num() > 2 ? FCString::Atof(*Args[2]) : .05f;
+
+    // Thin curved corridor, long convex banks give a large hull
+    // and frequent flips across hull edges
+
+    const float Radius = 100000.f;
+    const float Arc = 3.f;
+
+    TArray<float> Coords;
+    Coords.SetNumUninitialized(PointCount*2);
+
+    FRandomStream Rand(0);
+
+    for (int32 i=0; i<PointCount; ++i)
+    {
+        const float Angle = Rand.GetFraction() * Arc;
+        const float Offset = Radius + Rand.GetFraction() * Width;
+        Coords[i*2  ] = Offset * FMath::Cos(Angle);
+        Coords[i*2+1] = Offset * FMath::Sin(Angle);
+    }
+
+    int32 TriangleCount;
+    const double Time = BenchmarkTriangulation(Coords, Iterations, TriangleCount);
+
+    delaunator::TDelaunator<float> Delaunator;
+    Delaunator.coords = MakeArrayView(Coords);
+    Delaunator.update();
+
+    Ar.Logf(TEXT("Delaunator elongated benchmark: %d points, %d iterations, width %g"), PointCount, Iterations, Width);
+    Ar.Logf(TEXT("  %8.3f ms, %6.2f Mpts/s, %d triangles, %d hull points"), Time*1000.0, PointCount/Time*1e-6, TriangleCount, static_cast<int32>(Delaunator.hull_size));
+}
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice GDelaunatorBenchmarkElongatedCommand(
+    TEXT("Delaunator.BenchmarkElongated"),
+    TEXT("Triangulation throughput on a thin curved corridor. Arguments: [PointCount] [Iterations] [Width]"),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkElongated)
+    );
+
+} // namespace
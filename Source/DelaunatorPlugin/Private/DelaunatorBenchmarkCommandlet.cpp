@@ -0,0 +1,455 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "DelaunatorBenchmarkCommandlet.h"
+#include "DelaunatorPlugin.h"
+#include "DelaunatorCompareUtility.h"
+#include "DelaunatorObject.h"
+#include "DelaunatorUtility.h"
+#include "DelaunatorValueObject.h"
+#include "DelaunatorValueUtility.h"
+#include "DelaunatorVoronoi.h"
+#include "delaunator/delaunator.hpp"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+
+const float BenchmarkExtent = 100000.f;
+
+void GeneratePoints(TArray<FVector2D>& OutPoints, const FString& Distribution, int32 PointCount, FRandomStream& Rand)
+{
+    OutPoints.Reset(PointCount);
+
+    if (Distribution == TEXT("Clusters"))
+    {
+        // Gaussian clusters around uniform centers, Box-Muller offsets
+
+        const int32 ClusterCount = 32;
+        const float Sigma = BenchmarkExtent * .02f;
+
+        TArray<FVector2D> Centers;
+
+        for (int32 i=0; i<ClusterCount; ++i)
+        {
+            Centers.Emplace(Rand.GetFraction()*BenchmarkExtent, Rand.GetFraction()*BenchmarkExtent);
+        }
+
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            const float Radius = Sigma * FMath::Sqrt(-2.f * FMath::Loge(FMath::Max(Rand.GetFraction(), SMALL_NUMBER)));
+            const float Angle = 2.f * PI * Rand.GetFraction();
+            OutPoints.Emplace(Centers[i%ClusterCount] + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius);
+        }
+    }
+    else
+    if (Distribution == TEXT("Grid"))
+    {
+        const int32 CellCount = FMath::Max(1, FMath::RoundToInt(FMath::Sqrt(static_cast<float>(PointCount))));
+        int32 BoundaryPointOffset;
+
+        UDelaunatorUtility::GenerateJitteredGridPoints(
+            OutPoints,
+            BoundaryPointOffset,
+            FBox2D(FVector2D::ZeroVector, FVector2D(BenchmarkExtent, BenchmarkExtent)),
+            .85f,
+            CellCount
+            );
+    }
+    else
+    if (Distribution == TEXT("ParallelLines"))
+    {
+        // Points on a few parallel lines, long runs of collinear hull edges
+
+        const int32 LineCount = 8;
+
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            const float Y = (i%LineCount + .5f) * BenchmarkExtent / LineCount;
+            OutPoints.Emplace(Rand.GetFraction()*BenchmarkExtent, Y);
+        }
+    }
+    else
+    if (Distribution == TEXT("Collinear"))
+    {
+        // Points on one diagonal line, no triangulation exists
+
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            const float T = Rand.GetFraction() * BenchmarkExtent;
+            OutPoints.Emplace(T, T);
+        }
+    }
+    else
+    if (Distribution == TEXT("Cocircular"))
+    {
+        // Points within a thin ring, nearly every quad is close to cocircular
+
+        const float Radius = BenchmarkExtent * .5f;
+
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            const float Angle = 2.f * PI * Rand.GetFraction();
+            const float Offset = Radius * (1.f + (Rand.GetFraction()-.5f) * 1e-4f);
+            OutPoints.Emplace(FVector2D(Radius, Radius) + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Offset);
+        }
+    }
+    else
+    {
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            OutPoints.Emplace(Rand.GetFraction()*BenchmarkExtent, Rand.GetFraction()*BenchmarkExtent);
+        }
+    }
+}
+
+// Process memory relative to the start of one benchmark case. The platform
+// peak is process wide and cannot be reset, the case peak is sampled after
+// every measured run instead.
+struct FCaseMemory
+{
+    uint64 BaselineUsed;
+    uint64 PeakUsed;
+
+    FCaseMemory()
+    {
+        BaselineUsed = FPlatformMemory::GetStats().UsedPhysical;
+        PeakUsed = BaselineUsed;
+    }
+
+    void Sample()
+    {
+        PeakUsed = FMath::Max<uint64>(PeakUsed, FPlatformMemory::GetStats().UsedPhysical);
+    }
+
+    void Write(FJsonObject& Case)
+    {
+        Sample();
+
+        const double MB = 1024.0*1024.0;
+        const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+        Case.SetNumberField(TEXT("baseline_used_physical_mb"), BaselineUsed / MB);
+        Case.SetNumberField(TEXT("used_physical_delta_mb"), (static_cast<double>(UsedPhysical) - BaselineUsed) / MB);
+        Case.SetNumberField(TEXT("peak_used_physical_delta_mb"), (PeakUsed - BaselineUsed) / MB);
+    }
+};
+
+// Time Iterations runs after one warm up run, in milliseconds
+template<typename FOperation>
+TSharedRef<FJsonObject> MeasureOperation(int32 Iterations, FCaseMemory& Memory, FOperation Operation)
+{
+    Operation();
+    Memory.Sample();
+
+    TArray<double> Times;
+    Times.Reserve(Iterations);
+
+    for (int32 i=0; i<Iterations; ++i)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        Operation();
+        Times.Emplace((FPlatformTime::Seconds()-StartTime) * 1000.0);
+        Memory.Sample();
+    }
+
+    Times.Sort();
+
+    double TotalTime = 0.0;
+
+    for (double Time : Times)
+    {
+        TotalTime += Time;
+    }
+
+    // Nearest rank percentile
+    auto GetPercentile = [&Times](double Percentile)
+    {
+        const int32 Rank = FMath::CeilToInt(static_cast<float>(Percentile * Times.Num())) - 1;
+        return Times[FMath::Clamp(Rank, 0, Times.Num()-1)];
+    };
+
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("mean_ms"), TotalTime / Times.Num());
+    Result->SetNumberField(TEXT("min_ms"), Times[0]);
+    Result->SetNumberField(TEXT("p50_ms"), GetPercentile(.5));
+    Result->SetNumberField(TEXT("p90_ms"), GetPercentile(.9));
+    Result->SetNumberField(TEXT("p99_ms"), GetPercentile(.99));
+    Result->SetNumberField(TEXT("max_ms"), Times.Last());
+    return Result;
+}
+
+TSharedRef<FJsonObject> RunBenchmarkCase(
+    const FString& Distribution,
+    int32 PointCount,
+    int32 Iterations,
+    int32 QueryCount
+    )
+{
+    FRandomStream Rand(PointCount);
+    FCaseMemory CaseMemory;
+
+    TArray<FVector2D> Points;
+    GeneratePoints(Points, Distribution, PointCount, Rand);
+
+    TArray<FVector2D> QueryPoints;
+
+    for (int32 i=0; i<QueryCount; ++i)
+    {
+        QueryPoints.Emplace(Rand.GetFraction()*BenchmarkExtent, Rand.GetFraction()*BenchmarkExtent);
+    }
+
+    TSharedRef<FJsonObject> Case = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> Timings = MakeShared<FJsonObject>();
+
+    Case->SetStringField(TEXT("distribution"), Distribution);
+    Case->SetNumberField(TEXT("point_count"), Points.Num());
+    Case->SetNumberField(TEXT("query_count"), QueryCount);
+
+    {
+        delaunator::Delaunator Delaunator;
+        Delaunator.retain_capacity = true;
+
+        Timings->SetObjectField(TEXT("delaunator_update"), MeasureOperation(Iterations, CaseMemory, [&]()
+            {
+                Delaunator.update(Points);
+            } ));
+
+        Case->SetNumberField(TEXT("triangle_count"), Delaunator.triangles.Num() / 3);
+        Case->SetNumberField(TEXT("hull_size"), Delaunator.hull_size);
+
+        // Same input with exact predicate fallback enabled
+        Delaunator.robust_predicates = true;
+
+        Timings->SetObjectField(TEXT("delaunator_update_robust"), MeasureOperation(Iterations, CaseMemory, [&]()
+            {
+                Delaunator.update(Points);
+            } ));
+    }
+
+    UDelaunatorObject* Object = NewObject<UDelaunatorObject>();
+    Object->AddToRoot();
+
+    Timings->SetObjectField(TEXT("update_from_points"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            Object->UpdateFromPoints(Points);
+        } ));
+
+    // Degenerate input has no triangulation to query
+
+    if (! Object->IsValidDelaunatorObject())
+    {
+        Case->SetObjectField(TEXT("timings"), Timings);
+        CaseMemory.Write(*Case);
+
+        Object->RemoveFromRoot();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        return Case;
+    }
+
+    UDelaunatorVoronoi* Voronoi = NewObject<UDelaunatorVoronoi>();
+    Voronoi->AddToRoot();
+    Voronoi->GenerateFrom(Object);
+
+    Timings->SetObjectField(TEXT("voronoi_update"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            Voronoi->Update();
+        } ));
+
+    Timings->SetObjectField(TEXT("find_point"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            for (const FVector2D& QueryPoint : QueryPoints)
+            {
+                Object->FindPoint(QueryPoint);
+            }
+        } ));
+
+    // Same queries started from the point grid
+
+    Object->SetPointGridEnabled(true);
+
+    Timings->SetObjectField(TEXT("find_point_grid"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            for (const FVector2D& QueryPoint : QueryPoints)
+            {
+                Object->FindPoint(QueryPoint);
+            }
+        } ));
+
+    TArray<int32> QueryResults;
+    QueryResults.SetNumUninitialized(QueryPoints.Num());
+
+    Timings->SetObjectField(TEXT("find_points_batched"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            Object->FindPoints(QueryPoints, QueryResults);
+        } ));
+
+    Object->SetPointGridEnabled(false);
+
+    Timings->SetObjectField(TEXT("point_fill_visit"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            UDelaunatorValueUtility::PointFillVisit(Object, 0);
+        } ));
+
+    Object->SetNeighbourCacheEnabled(true);
+
+    Timings->SetObjectField(TEXT("point_fill_visit_cached"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            UDelaunatorValueUtility::PointFillVisit(Object, 0);
+        } ));
+
+    Object->SetNeighbourCacheEnabled(false);
+
+    // Point values compared against a literal, about half of the points pass
+
+    UDelaunatorValueObject* ValueObject = Object->CreateDefaultPointValueObject(
+        TEXT("BenchmarkValue"),
+        UDelaunatorFloatValueObject::StaticClass()
+        );
+
+    for (int32 i=0; i<Object->GetPointCount(); ++i)
+    {
+        ValueObject->SetValueFloat(i, Rand.GetFraction());
+    }
+
+    UDelaunatorCompareOperatorBinary* CompareOperator = UDelaunatorCompareUtility::CreateBinaryOperator(
+        Object,
+        UDelaunatorCompareUtility::CreateValueObjectOperator(Object, ValueObject),
+        UDelaunatorCompareUtility::CreateFloatValueOperator(Object, .5f),
+        EDelaunatorBinaryCompareOperation::DELBCO_GreaterThan
+        );
+    CompareOperator->AddToRoot();
+
+    TArray<int32> ComparePoints;
+
+    Timings->SetObjectField(TEXT("compare_operator"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            Object->FindPointsByValue(ComparePoints, CompareOperator);
+        } ));
+
+    TArray<float> InterpolatedValues;
+    InterpolatedValues.SetNumUninitialized(QueryPoints.Num());
+
+    Timings->SetObjectField(TEXT("interpolate_values"), MeasureOperation(Iterations, CaseMemory, [&]()
+        {
+            Object->InterpolateValues(ValueObject, QueryPoints, InterpolatedValues);
+        } ));
+
+    Case->SetObjectField(TEXT("timings"), Timings);
+
+    CaseMemory.Write(*Case);
+
+    CompareOperator->RemoveFromRoot();
+    Voronoi->RemoveFromRoot();
+    Object->RemoveFromRoot();
+
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    return Case;
+}
+
+} // namespace
+
+UDelaunatorBenchmarkCommandlet::UDelaunatorBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Benchmark triangulation, voronoi and query performance over generated point sets");
+    HelpUsage = TEXT("-run=DelaunatorBenchmark [-Sizes=1000,10000] [-Distributions=Uniform,Clusters,Grid,ParallelLines,Collinear,Cocircular] [-Iterations=5] [-Queries=10000] [-Output=File]");
+}
+
+int32 UDelaunatorBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString SizesParam(TEXT("1000,10000,100000,1000000,10000000"));
+    FString DistributionsParam(TEXT("Uniform,Clusters,Grid,ParallelLines,Collinear,Cocircular"));
+    FString OutputFile(FPaths::ProjectSavedDir() / TEXT("Benchmark") / TEXT("DelaunatorBenchmark.json"));
+    int32 Iterations = 5;
+    int32 QueryCount = 10000;
+
+    FParse::Value(*Params, TEXT("Sizes="), SizesParam, false);
+    FParse::Value(*Params, TEXT("Distributions="), DistributionsParam, false);
+    FParse::Value(*Params, TEXT("Output="), OutputFile);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("Queries="), QueryCount);
+
+    Iterations = FMath::Max(1, Iterations);
+    QueryCount = FMath::Max(1, QueryCount);
+
+    TArray<FString> Sizes;
+    TArray<FString> Distributions;
+    SizesParam.ParseIntoArray(Sizes, TEXT(","));
+    DistributionsParam.ParseIntoArray(Distributions, TEXT(","));
+
+    TArray<TSharedPtr<FJsonValue>> Cases;
+
+    for (const FString& Distribution : Distributions)
+    {
+        for (const FString& Size : Sizes)
+        {
+            const int32 PointCount = FCString::Atoi(*Size);
+
+            if (PointCount < 3)
+            {
+                continue;
+            }
+
+            UE_LOG(LogDel, Display, TEXT("Delaunator benchmark: %s, %d points"), *Distribution, PointCount);
+
+            Cases.Emplace(MakeShared<FJsonValueObject>(RunBenchmarkCase(Distribution, PointCount, Iterations, QueryCount)));
+        }
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+    Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand());
+    Root->SetNumberField(TEXT("core_count"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+    Root->SetNumberField(TEXT("iterations"), Iterations);
+    Root->SetArrayField(TEXT("cases"), Cases);
+
+    FString Output;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    if (! FFileHelper::SaveStringToFile(Output, *OutputFile))
+    {
+        UE_LOG(LogDel, Error, TEXT("Delaunator benchmark: failed to write %s"), *OutputFile);
+        return 1;
+    }
+
+    UE_LOG(LogDel, Display, TEXT("Delaunator benchmark: results written to %s"), *OutputFile);
+
+    return 0;
+}
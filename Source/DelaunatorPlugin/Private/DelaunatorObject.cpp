@@ -26,1081 +26,2502 @@
 // 
 
 #include "DelaunatorObject.h"
+#include "DelaunatorPlugin.h"
+#include "DelaunatorStream.h"
 #include "Poly/GULPolyUtilityLibrary.h"
 #include "DelaunatorVoronoi.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "LatentActions.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Detached triangulation state built by UpdateFromPointsAsync()
+struct FDelaunatorObjectBuild
+{
+    delaunator::Delaunator Delaunator;
+    TArray<FVector2D> Points;
+    TArray<int32> Hull;
+    TArray<int32> HullIndex;
+    TArray<int32> Inedges;
+    uint32 Serial;
+};
+
+// Latent action waiting for an asynchronous update to be published
+class FDelaunatorUpdateLatentAction : public FPendingLatentAction
+{
+public:
+
+    TFuture<bool> Future;
+    FName ExecutionFunction;
+    int32 OutputLink;
+    FWeakObjectPtr CallbackTarget;
+
+    FDelaunatorUpdateLatentAction(TFuture<bool>&& InFuture, const FLatentActionInfo& LatentInfo)
+        : Future(MoveTemp(InFuture))
+        , ExecutionFunction(LatentInfo.ExecutionFunction)
+        , OutputLink(LatentInfo.Linkage)
+        , CallbackTarget(LatentInfo.CallbackTarget)
+    {
+    }
+
+    virtual void UpdateOperation(FLatentResponse& Response) override
+    {
+        Response.FinishAndTriggerIf(Future.IsReady(), ExecutionFunction, OutputLink, CallbackTarget);
+    }
+};
+
+void UDelaunatorObject::BeginDestroy()
+{
+    DEC_MEMORY_STAT_BY(STAT_DelaunatorAllocatedMemory, StatAllocatedSize);
+    StatAllocatedSize = 0;
+
+    Super::BeginDestroy();
+}
 
 void UDelaunatorObject::UpdateFromPoints(const TArray<FVector2D>& InPoints)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPoints);
+
+    // Discard pending asynchronous results
+    ++BuildSerial;
+
+    // Copy assign, reuses the existing point allocation
     Points = InPoints;
+    SharedPoints.Reset();
     Delaunator.update(Points);
 
-    const TArray<int32>& InTriangles(GetTriangles());
-    const TArray<int32>& InHalfEdges(GetHalfEdges());
-
-    const int32 PointCount = Points.Num();
+    UpdateTopology();
+}
 
-    // Generate hull and boundary data
+void UDelaunatorObject::UpdateFromPoints(TArray<FVector2D>&& InPoints)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPoints);
 
-    Hull.Reset(Delaunator.hull_size);
+    ++BuildSerial;
 
-    {
-        int32 e = Delaunator.hull_start;
-        do
-        {
-            Hull.Emplace(e);
-        }
-        while ((e = Delaunator.hull_next[e]) != Delaunator.hull_start);
+    Points = MoveTemp(InPoints);
+    SharedPoints.Reset();
+    Delaunator.update(Points);
 
-        HullIndex.SetNumUninitialized(PointCount);
-        FMemory::Memset(
-            HullIndex.GetData(),
-            ~0,
-            HullIndex.Num()*HullIndex.GetTypeSize()
-            );
+    UpdateTopology();
+}
 
-        for (int32 i=0; i<Hull.Num(); ++i)
-        {
-            HullIndex[Hull[i]] = i;
-        }
+void UDelaunatorObject::UpdateFromPointsParallel(const TArray<FVector2D>& InPoints, int32 SlabCount)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPointsParallel);
 
-        // Generate hull point flags
-        
-        //BoundaryFlags.Init(false, GetPointCount());
+    ++BuildSerial;
 
-        //for (int32 i : Hull)
-        //{
-        //    BoundaryFlags[i] = true;
-        //}
-    }
-    
+    Points = InPoints;
+    SharedPoints.Reset();
+    Delaunator.update_parallel(Points, SlabCount);
 
-    // Generate Inedges
+    UpdateTopology();
+}
 
-    // Compute an index from each point to an (arbitrary) incoming halfedge
-    // Used to give the first neighbor of each point; for this reason,
-    // on the hull we give priority to exterior halfedges
+void UDelaunatorObject::UpdateFromPointsParallel(TArray<FVector2D>&& InPoints, int32 SlabCount)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPointsParallel);
 
-    Inedges.SetNumUninitialized(PointCount);
-    FMemory::Memset(Inedges.GetData(), ~0, Inedges.Num()*Inedges.GetTypeSize());
+    ++BuildSerial;
 
-    for (int32 e=0; e<InHalfEdges.Num(); ++e)
-    {
-        const int32 p = InTriangles[((e%3) == 2) ? e-2 : e+1];
+    Points = MoveTemp(InPoints);
+    SharedPoints.Reset();
+    Delaunator.update_parallel(Points, SlabCount);
 
-        if (InHalfEdges[e] == -1 || Inedges[p] == -1)
-        {
-            Inedges[p] = e;
-        }
-    }
+    UpdateTopology();
 }
 
-void UDelaunatorObject::CopyIndices(TArray<int32>& OutTriangles, TArray<int32>& OutHalfEdges)
+void UDelaunatorObject::UpdateFromSharedPoints(const FDelaunatorSharedPoints& InPoints, int32 SlabCount)
 {
-    OutTriangles = Delaunator.triangles;
-    OutHalfEdges = Delaunator.halfedges;
-}
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromSharedPoints);
 
-UDelaunatorValueObject* UDelaunatorObject::CreateDefaultValueObject(
-    UObject* Outer,
-    FName ValueName,
-    TSubclassOf<UDelaunatorValueObject> ValueType
-    )
-{
-    if (! IsValidDelaunatorObject() || ValueName.IsNone())
-    {
-        return nullptr;
-    }
+    ++BuildSerial;
 
-    UDelaunatorValueObject* ValueObject = GetValueObject(ValueName);
+    // Triangulate directly over the shared buffer, release owned points
+    SharedPoints = InPoints;
+    Points.Empty();
 
-    if (! IsValid(ValueObject))
+    if (SlabCount == 1)
     {
-        ValueObject = NewObject<UDelaunatorValueObject>(Outer, ValueType);
-        ValueMap.Emplace(ValueName, ValueObject);
+        Delaunator.update(*SharedPoints);
+    }
+    else
+    {
+        Delaunator.update_parallel(*SharedPoints, SlabCount);
     }
 
-    return ValueObject;
+    UpdateTopology();
 }
 
-UDelaunatorValueObject* UDelaunatorObject::CreateDefaultPointValueObject(
-    FName ValueName,
-    TSubclassOf<UDelaunatorValueObject> ValueType
-    )
+bool UDelaunatorObject::UpdateFromStreamMesh(FDelaunatorStreamMesh& Mesh, const FBox2D& Bounds, TArray<int32>& OutPointIndices)
 {
-    UDelaunatorValueObject* ValueObject = CreateDefaultValueObject(
-        ValueName,
-        ValueType
-        );
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromStreamMesh);
 
-    if (IsValid(ValueObject))
+    OutPointIndices.Reset();
+
+    if (! Mesh.IsOpen())
     {
-        ValueObject->InitializeValues(GetPointCount());
+        return false;
     }
 
-    return ValueObject;
-}
+    // Points are sorted along X, gather points within bounds
 
-UDelaunatorValueObject* UDelaunatorObject::CreateDefaultTriangleValueObject(
-    FName ValueName,
-    TSubclassOf<UDelaunatorValueObject> ValueType
-    )
-{
-    UDelaunatorValueObject* ValueObject = CreateDefaultValueObject(
-        ValueName,
-        ValueType
-        );
+    int32 FirstPoint;
+    int32 LastPoint;
+    Mesh.FindPointRange(Bounds.Min.X, Bounds.Max.X, FirstPoint, LastPoint);
 
-    if (IsValid(ValueObject))
+    TArray<int32> LocalIndices;
+    TArray<FVector2D> NewPoints;
+    LocalIndices.Init(-1, LastPoint-FirstPoint);
+
+    for (int32 i=FirstPoint; i<LastPoint; ++i)
     {
-        ValueObject->InitializeValues(GetTriangleCount());
+        const FVector2D& Point(Mesh.GetPoint(i));
+
+        if (Point.Y >= Bounds.Min.Y && Point.Y <= Bounds.Max.Y)
+        {
+            LocalIndices[i-FirstPoint] = NewPoints.Num();
+            NewPoints.Emplace(Point);
+            OutPointIndices.Emplace(i);
+        }
     }
 
-    return ValueObject;
-}
+    // Gather triangles from pages overlapping the point range
 
-void UDelaunatorObject::ResetPointValueObject(UDelaunatorValueObject* ValueObject)
-{
-    if (IsValid(ValueObject))
+    TArray<int32> NewTriangles;
+    TArray<int32> NewHalfEdges;
+    TMap<int32, int32> TriangleMap;
+
+    for (int32 PageIndex=0; PageIndex<Mesh.GetPageCount(); ++PageIndex)
     {
-        ValueObject->InitializeValues(GetPointCount());
+        const FDelaunatorStreamPage& PageInfo(Mesh.GetPageInfo(PageIndex));
+
+        if (PageInfo.MaxPoint < FirstPoint || PageInfo.MinPoint >= LastPoint)
+        {
+            continue;
+        }
+
+        TArrayView<const FDelaunatorStreamTriangle> Page(Mesh.GetPage(PageIndex));
+
+        for (int32 k=0; k<Page.Num(); ++k)
+        {
+            const FDelaunatorStreamTriangle& Triangle(Page[k]);
+            int32 Local[3];
+
+            for (int32 c=0; c<3; ++c)
+            {
+                const int32 i = Triangle.Points[c];
+                Local[c] = (i >= FirstPoint && i < LastPoint) ? LocalIndices[i-FirstPoint] : -1;
+            }
+
+            if (Local[0] < 0 || Local[1] < 0 || Local[2] < 0)
+            {
+                continue;
+            }
+
+            TriangleMap.Emplace(PageIndex*Mesh.GetPageTriangleCount() + k, NewTriangles.Num()/3);
+
+            for (int32 c=0; c<3; ++c)
+            {
+                NewTriangles.Emplace(Local[c]);
+                NewHalfEdges.Emplace(Triangle.HalfEdges[c]);
+            }
+        }
     }
-}
 
-void UDelaunatorObject::ResetTriangleValueObject(UDelaunatorValueObject* ValueObject)
-{
-    if (IsValid(ValueObject))
+    if (NewTriangles.Num() < 3)
     {
-        ValueObject->InitializeValues(GetTriangleCount());
+        OutPointIndices.Reset();
+        return false;
     }
-}
 
-int32 UDelaunatorObject::FindPointByValue(UDelaunatorCompareOperator* CompareOperator)
-{
-    return IsValid(CompareOperator)
-        ? CompareOperator->GetResult(GetPointCount())
-        : -1;
-}
+    // Remap global halfedges, twins outside the window become boundary
 
-void UDelaunatorObject::FindPointsByValue(
-    TArray<int32>& OutPointIndices,
-    UDelaunatorCompareOperator* CompareOperator
-    )
-{
-    if (IsValid(CompareOperator))
+    for (int32& e : NewHalfEdges)
     {
-        CompareOperator->GetResults(OutPointIndices, GetPointCount());
+        const int32* t = (e >= 0) ? TriangleMap.Find(e/3) : nullptr;
+        e = t ? (*t)*3 + (e%3) : -1;
     }
-}
 
-void UDelaunatorObject::FindTrianglesByValue(
-    TArray<int32>& OutTriangleIndices,
-    UDelaunatorCompareOperator* CompareOperator
-    )
-{
-    if (IsValid(CompareOperator))
+    // Point walks need one convex boundary loop. Streamed triangles are
+    // delaunay within any subset of their points, a fresh triangulation
+    // of the window points keeps them and fills the boundary pockets.
+    if (! HasConvexBoundary(NewPoints, NewTriangles, NewHalfEdges))
     {
-        CompareOperator->GetResults(OutTriangleIndices, GetTriangleCount());
+        UpdateFromPoints(MoveTemp(NewPoints));
+        return IsValidDelaunatorObject();
     }
-}
 
-// Query Utility
+    UpdateFromTriangulation(MoveTemp(NewPoints), MoveTemp(NewTriangles), MoveTemp(NewHalfEdges));
 
-void UDelaunatorObject::GetTrianglesByPointIndices(
-    TArray<int32>& OutTriangles,
-    const TArray<int32>& InPointIndices,
-    bool bInverseResult
+    return true;
+}
+
+bool UDelaunatorObject::HasConvexBoundary(
+    const TArray<FVector2D>& InPoints,
+    const TArray<int32>& InTriangles,
+    const TArray<int32>& InHalfEdges
     )
 {
-    OutTriangles.Reset();
+    TArray<int32> BoundaryNext;
+    BoundaryNext.Init(-1, InPoints.Num());
 
-    // Invalid delaunator object, abort
-    if (! IsValidDelaunatorObject())
+    int32 BoundaryCount = 0;
+    int32 Start = -1;
+
+    for (int32 e=0; e<InHalfEdges.Num(); ++e)
     {
-        return;
-    }
+        if (InHalfEdges[e] != -1)
+        {
+            continue;
+        }
 
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
-    const int32 TriangleCount = GetTriangleCount();
+        const int32 a = InTriangles[e];
 
-    // Generate valid point index set
-    TSet<int32> PointIndexSet(InPointIndices.FilterByPredicate(
-        [&InPoints](const int32& PointIndex)
+        // Boundary pinched at a point
+        if (BoundaryNext[a] != -1)
         {
-            return InPoints.IsValidIndex(PointIndex);
-        } ) );
+            return false;
+        }
 
-    // No valid point index, abort
-    if (PointIndexSet.Num() < 1)
-    {
-        return;
+        BoundaryNext[a] = InTriangles[((e%3) == 2) ? e-2 : e+1];
+        Start = a;
+        ++BoundaryCount;
     }
 
-    // Gather all triangles that consist of any of the point indices
-    if (! bInverseResult)
+    if (BoundaryCount < 3)
     {
-        for (int32 ti=0; ti<TriangleCount; ++ti)
-        {
-            int32 i = ti*3;
-
-            if (PointIndexSet.Contains(InTriangles[i  ]) ||
-                PointIndexSet.Contains(InTriangles[i+1]) ||
-                PointIndexSet.Contains(InTriangles[i+2]))
-            {
-                OutTriangles.Emplace(ti);
-            }
-        }
+        return false;
     }
-    else
+
+    // Boundary edges follow triangle winding, convex turns keep its sign
+
+    auto GetOrient = [&InPoints](int32 a, int32 b, int32 c)
     {
-        for (int32 ti=0; ti<TriangleCount; ++ti)
-        {
-            int32 i = ti*3;
+        return delaunator::orient_exact(
+            InPoints[a].X, InPoints[a].Y,
+            InPoints[b].X, InPoints[b].Y,
+            InPoints[c].X, InPoints[c].Y
+            );
+    };
 
-            if (PointIndexSet.Contains(InTriangles[i  ]) ||
-                PointIndexSet.Contains(InTriangles[i+1]) ||
-                PointIndexSet.Contains(InTriangles[i+2]))
-            {
-                continue;
-            }
+    const double Winding = GetOrient(InTriangles[0], InTriangles[1], InTriangles[2]);
 
-            OutTriangles.Emplace(ti);
+    int32 a = Start;
+    int32 LoopCount = 0;
+
+    do
+    {
+        const int32 b = BoundaryNext[a];
+        const int32 c = BoundaryNext[b];
+
+        if (b < 0 || c < 0 || GetOrient(a, b, c) * Winding < 0.0)
+        {
+            return false;
         }
+
+        a = b;
+        ++LoopCount;
     }
+    while (a != Start && LoopCount <= BoundaryCount);
+
+    // Single loop over all boundary edges
+    return LoopCount == BoundaryCount;
 }
 
-void UDelaunatorObject::GetTrianglesByEdgeIndices(
-    TArray<int32>& OutTriangles,
-    const TArray<int32>& InPointIndices,
-    bool bInverseResult
-    )
+void UDelaunatorObject::UpdateFromTriangulation(TArray<FVector2D>&& InPoints, TArray<int32>&& InTriangles, TArray<int32>&& InHalfEdges)
 {
-    OutTriangles.Reset();
+    ++BuildSerial;
 
-    // Invalid delaunator object, abort
-    if (! IsValidDelaunatorObject())
+    Points = MoveTemp(InPoints);
+    SharedPoints.Reset();
+
+    Delaunator.coords = MakeArrayView(&Points.GetData()->X, Points.Num()*2);
+    Delaunator.assign(MoveTemp(InTriangles), MoveTemp(InHalfEdges));
+
+    UpdateTopology();
+}
+
+void UDelaunatorObject::DetachSharedPoints()
+{
+    if (! SharedPoints.IsValid())
     {
         return;
     }
 
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
-    const int32 TriangleCount = GetTriangleCount();
+    // Copy on write, the shared buffer is never modified
+    Points = *SharedPoints;
+    SharedPoints.Reset();
 
-    // Generate valid point index set
-    TSet<int32> PointIndexSet(InPointIndices.FilterByPredicate(
-        [&InPoints](const int32& PointIndex)
-        {
-            return InPoints.IsValidIndex(PointIndex);
-        } ) );
+    Delaunator.coords = MakeArrayView(&Points.GetData()->X, Points.Num()*2);
+}
 
-    // No valid point index, abort
-    if (PointIndexSet.Num() < 1)
+TFuture<bool> UDelaunatorObject::UpdateFromPointsAsync(const TArray<FVector2D>& InPoints)
+{
+    return UpdateFromPointsAsync(TArray<FVector2D>(InPoints));
+}
+
+TFuture<bool> UDelaunatorObject::UpdateFromPointsAsync(TArray<FVector2D>&& InPoints)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPointsAsync);
+
+    check(IsInGameThread());
+
+    if (InPoints.Num() < 3)
     {
-        return;
+        TPromise<bool> Promise;
+        Promise.SetValue(false);
+        return Promise.GetFuture();
     }
 
-    // Gather all triangles that consist of any of the point indices
-    if (! bInverseResult)
-    {
-        for (int32 ti=0; ti<TriangleCount; ++ti)
-        {
-            int32 i = ti*3;
-            bool bInSet0 = PointIndexSet.Contains(InTriangles[i  ]);
-            bool bInSet1 = PointIndexSet.Contains(InTriangles[i+1]);
-            bool bInSet2 = PointIndexSet.Contains(InTriangles[i+2]);
+    typedef TSharedRef<FDelaunatorObjectBuild, ESPMode::ThreadSafe> FBuildRef;
+    typedef TSharedRef<TPromise<bool>, ESPMode::ThreadSafe> FPromiseRef;
 
-            if ((bInSet0 && bInSet1) ||
-                (bInSet0 && bInSet2) ||
-                (bInSet1 && bInSet2))
-            {
-                OutTriangles.Emplace(ti);
-            }
-        }
-    }
-    else
+    FBuildRef Build(MakeShared<FDelaunatorObjectBuild, ESPMode::ThreadSafe>());
+    Build->Points = MoveTemp(InPoints);
+    Build->Delaunator.robust_predicates = Delaunator.robust_predicates;
+    Build->Delaunator.retain_capacity = Delaunator.retain_capacity;
+    Build->Serial = ++BuildSerial;
+
+    FPromiseRef Promise(MakeShared<TPromise<bool>, ESPMode::ThreadSafe>());
+    TFuture<bool> Future(Promise->GetFuture());
+    TWeakObjectPtr<UDelaunatorObject> WeakThis(this);
+
+    // Triangulate and derive topology off the game thread,
+    // then publish on the game thread between queries
+
+    Async(EAsyncExecution::ThreadPool, [Build, Promise, WeakThis]()
     {
-        for (int32 ti=0; ti<TriangleCount; ++ti)
-        {
-            int32 i = ti*3;
-            bool bInSet0 = PointIndexSet.Contains(InTriangles[i  ]);
-            bool bInSet1 = PointIndexSet.Contains(InTriangles[i+1]);
-            bool bInSet2 = PointIndexSet.Contains(InTriangles[i+2]);
+        TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateFromPointsAsync_Worker);
 
-            if ((bInSet0 && bInSet1) ||
-                (bInSet0 && bInSet2) ||
-                (bInSet1 && bInSet2))
-            {
-                continue;
-            }
+        FDelaunatorObjectBuild& BuildData(*Build);
 
-            OutTriangles.Emplace(ti);
-        }
-    }
-}
+        BuildData.Delaunator.update(BuildData.Points);
 
-void UDelaunatorObject::GetPointNeighbours(TArray<int32>& OutNeighbourIndices, int32 PointIndex) const
-{
-    check(IsValidDelaunatorObject());
+        UpdateTopology(
+            BuildData.Delaunator,
+            BuildData.Points.Num(),
+            BuildData.Hull,
+            BuildData.HullIndex,
+            BuildData.Inedges
+            );
 
-    OutNeighbourIndices.Reset();
+        AsyncTask(ENamedThreads::GameThread, [Build, Promise, WeakThis]()
+        {
+            UDelaunatorObject* Object = WeakThis.Get();
+            Promise->SetValue(Object && Object->PublishBuild(*Build));
+        } );
+    } );
 
-    const TArray<int32>& InTriangles(GetTriangles());
-    const TArray<int32>& InHalfEdges(GetHalfEdges());
-    const TArray<int32>& InInedges(GetInedges());
+    return Future;
+}
 
-    const int32 e0 = InInedges[PointIndex];
+void UDelaunatorObject::UpdateFromPointsLatent(UObject* WorldContextObject, const TArray<FVector2D>& InPoints, FLatentActionInfo LatentInfo)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
 
-    // coincident point, skip
-    if (e0 == -1)
+    if (! World)
     {
         return;
     }
 
-    // Iterate over point triangles
+    FLatentActionManager& LatentManager(World->GetLatentActionManager());
 
-    int32 e = e0;
-    do
+    if (! LatentManager.FindExistingAction<FDelaunatorUpdateLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
     {
-        const int32 t = e / 3;
-        const int32 f = t * 3;
+        LatentManager.AddNewAction(
+            LatentInfo.CallbackTarget,
+            LatentInfo.UUID,
+            new FDelaunatorUpdateLatentAction(UpdateFromPointsAsync(InPoints), LatentInfo)
+            );
+    }
+}
 
-        OutNeighbourIndices.Emplace(InTriangles[e]);
+bool UDelaunatorObject::PublishBuild(FDelaunatorObjectBuild& Build)
+{
+    // Superseded by a later update
+    if (Build.Serial != BuildSerial)
+    {
+        return false;
+    }
 
-        e = ((e-f) < 2) ? e+1 : f;
+    Build.Delaunator.allocation_count += Delaunator.allocation_count;
 
-        // Ensure sane triangulation
-        check(PointIndex == InTriangles[e]);
+    Swap(Delaunator, Build.Delaunator);
+    Swap(Points, Build.Points);
+    SharedPoints.Reset();
+    Swap(Hull, Build.Hull);
+    Swap(HullIndex, Build.HullIndex);
+    Swap(Inedges, Build.Inedges);
 
-        e = InHalfEdges[e];
-    }
-    while (e != e0 && e != -1);
+    UpdatePointGrid();
+    UpdateNeighbourCache();
+    UpdateStats();
+
+    return true;
 }
 
-void UDelaunatorObject::GetPointNeighbours(TArray<int32>& OutNeighbourIndices, TArray<int32>& OutNeighbourTriangles, int32 PointIndex) const
+void UDelaunatorObject::UpdateTopology()
 {
-    check(IsValidDelaunatorObject());
+    UpdateTopology(Delaunator, GetPoints().Num(), Hull, HullIndex, Inedges);
+    UpdatePointGrid();
+    UpdateNeighbourCache();
+    UpdateStats();
+}
 
-    OutNeighbourIndices.Reset();
-    OutNeighbourTriangles.Reset();
+void UDelaunatorObject::UpdateStats()
+{
+    INC_DWORD_STAT_BY(STAT_DelaunatorLegalizeFlips, Delaunator.flip_count);
+    INC_DWORD_STAT_BY(STAT_DelaunatorHullHashProbes, Delaunator.hash_probe_count);
+    INC_DWORD_STAT_BY(STAT_DelaunatorHullWalkSteps, Delaunator.hull_step_count);
+
+    Delaunator.flip_count = 0;
+    Delaunator.hash_probe_count = 0;
+    Delaunator.hull_step_count = 0;
+
+    const SIZE_T AllocatedSize =
+        Points.GetAllocatedSize()                +
+        Hull.GetAllocatedSize()                  +
+        HullIndex.GetAllocatedSize()             +
+        Inedges.GetAllocatedSize()               +
+        PointGrid.GetAllocatedSize()             +
+        NeighbourOffsets.GetAllocatedSize()      +
+        NeighbourIndices.GetAllocatedSize()      +
+        Delaunator.triangles.GetAllocatedSize()  +
+        Delaunator.halfedges.GetAllocatedSize()  +
+        Delaunator.hull_prev.GetAllocatedSize()  +
+        Delaunator.hull_next.GetAllocatedSize()  +
+        Delaunator.hull_tri.GetAllocatedSize();
+
+    DEC_MEMORY_STAT_BY(STAT_DelaunatorAllocatedMemory, StatAllocatedSize);
+    INC_MEMORY_STAT_BY(STAT_DelaunatorAllocatedMemory, AllocatedSize);
+
+    StatAllocatedSize = AllocatedSize;
+}
 
-    const TArray<int32>& InTriangles(GetTriangles());
-    const TArray<int32>& InHalfEdges(GetHalfEdges());
-    const TArray<int32>& InInedges(GetInedges());
+void UDelaunatorObject::UpdateTopology(
+    const delaunator::Delaunator& InDelaunator,
+    int32 PointCount,
+    TArray<int32>& OutHull,
+    TArray<int32>& OutHullIndex,
+    TArray<int32>& OutInedges
+    )
+{
+    const TArray<int32>& InTriangles(InDelaunator.triangles);
+    const TArray<int32>& InHalfEdges(InDelaunator.halfedges);
 
-    const int32 e0 = InInedges[PointIndex];
+    const int32 TriangleCount = InTriangles.Num() / 3;
 
-    // coincident point, skip
-    if (e0 == -1)
-    {
-        return;
-    }
+    // Work items per parallel chunk
+    const int32 ChunkSize = 1 << 14;
 
-    // Iterate over point triangles
+    // Clear hull indices and inedges
 
-    int32 e = e0;
-    do
+    OutHull.Reset();
+    OutHullIndex.SetNumUninitialized(PointCount, false);
+    OutInedges.SetNumUninitialized(PointCount, false);
+
+    ParallelFor(FMath::DivideAndRoundUp(PointCount, ChunkSize), [&](int32 ChunkIndex)
     {
-        const int32 t = e / 3;
-        const int32 f = t * 3;
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 Count = FMath::Min(ChunkSize, PointCount-Start);
 
-        OutNeighbourIndices.Emplace(InTriangles[e]);
-        OutNeighbourTriangles.Emplace(t);
+        FMemory::Memset(OutHullIndex.GetData()+Start, ~0, Count*OutHullIndex.GetTypeSize());
+        FMemory::Memset(OutInedges.GetData()+Start, ~0, Count*OutInedges.GetTypeSize());
+    } );
 
-        e = ((e-f) < 2) ? e+1 : f;
+    // Generate hull and boundary data
 
-        // Ensure sane triangulation
-        check(PointIndex == InTriangles[e]);
+    UpdateHull(InDelaunator, OutHull, OutHullIndex);
 
-        e = InHalfEdges[e];
-    }
-    while (e != e0 && e != -1);
-}
+    // Generate Inedges
 
-// Boundary Utility
+    // Compute an index from each point to an (arbitrary) incoming halfedge
+    // Used to give the first neighbor of each point; for this reason,
+    // on the hull we give priority to exterior halfedges
 
-void UDelaunatorObject::GetPointTrianglesBoundary(
-    TArray<int32>& OutTriangleIndices,
-    int32 InTrianglePointIndex
-    ) const
-{
-    const TArray<int32>& InTriangles(GetTriangles());
-    const TArray<int32>& InHalfEdges(GetHalfEdges());
+    // Each point is written by a single halfedge, the exterior one on the
+    // hull and the lowest incoming one otherwise, same as a serial pass
+    // keeping the first incoming halfedge
 
-    if (! InTriangles.IsValidIndex(InTrianglePointIndex))
+    ParallelFor(FMath::DivideAndRoundUp(TriangleCount, ChunkSize), [&](int32 ChunkIndex)
     {
-        return;
-    }
+        const int32 TriStart = ChunkIndex * ChunkSize;
+        const int32 TriEnd = FMath::Min(TriStart+ChunkSize, TriangleCount);
 
-    int32 InitialTriangleIndex = InTrianglePointIndex/3;
+        for (int32 t=TriStart; t<TriEnd; ++t)
+        for (int32 c=0; c<3; ++c)
+        {
+            const int32 e = t*3 + c;
+            const int32 en = t*3 + GetNextTriCorner(c);
+            const int32 p = InTriangles[en];
 
-    // Add initial triangle
-    OutTriangleIndices.Emplace(InitialTriangleIndex);
+            if (InHalfEdges[e] == -1)
+            {
+                OutInedges[p] = e;
+                continue;
+            }
 
-    // Start from initial point index and iterate CCW
+            // Walk incoming halfedges around p until back at e,
+            // stop on hull points or lower incoming halfedges
 
-    int32 HalfEdge = InHalfEdges[InTrianglePointIndex];
+            int32 ie = InHalfEdges[en];
 
-    while (HalfEdge >= 0)
-    {
-        int32 TriangleIndex = HalfEdge/3;
-        int32 PointIndex = GetNextTriCorner(TriangleIndex, HalfEdge);
+            while (ie > e)
+            {
+                ie = InHalfEdges[((ie%3) == 2) ? ie-2 : ie+1];
+            }
 
-        // All point triangles visited, break
-        if (PointIndex == InTrianglePointIndex)
-        {
-            break;
+            if (ie == e)
+            {
+                OutInedges[p] = e;
+            }
         }
+    } );
+}
 
-        // Add next triangle
-        OutTriangleIndices.Emplace(TriangleIndex);
+void UDelaunatorObject::UpdateHull()
+{
+    UpdateHull(Delaunator, Hull, HullIndex);
+}
 
-        // Get corner of next triangle
-        HalfEdge = InHalfEdges[PointIndex];
-    }
+void UDelaunatorObject::UpdateHull(
+    const delaunator::Delaunator& InDelaunator,
+    TArray<int32>& OutHull,
+    TArray<int32>& OutHullIndex
+    )
+{
+    // Clear previous hull indices
 
-    // All point triangles visited, return
-    if (HalfEdge >= 0)
+    for (int32 i : OutHull)
     {
-        return;
+        OutHullIndex[i] = -1;
     }
 
-    // Start from initial point index and iterate CW
+    OutHull.Reset(InDelaunator.hull_size);
 
-    HalfEdge = InHalfEdges[GetPrevTriCorner(InitialTriangleIndex, InTrianglePointIndex)];
+    // Collinear input, no triangulation
+    if (InDelaunator.hull_size < 1)
+    {
+        return;
+    }
 
-    while (HalfEdge >= 0)
+    int32 e = InDelaunator.hull_start;
+    do
     {
-        int32 TriangleIndex = HalfEdge/3;
-        int32 PointIndex = HalfEdge;
+        OutHull.Emplace(e);
+    }
+    while ((e = InDelaunator.hull_next[e]) != InDelaunator.hull_start);
 
-        // Ensure no cyclic iteration
-        check(PointIndex != InTrianglePointIndex);
+    for (int32 i=0; i<OutHull.Num(); ++i)
+    {
+        OutHullIndex[OutHull[i]] = i;
+    }
 
-        // Add prev triangle
-        OutTriangleIndices.Emplace(TriangleIndex);
+    // Generate hull point flags
+    
+    //BoundaryFlags.Init(false, GetPointCount());
 
-        // Get corner of prev triangle
-        HalfEdge = InHalfEdges[GetPrevTriCorner(TriangleIndex, PointIndex)];
-    }
+    //for (int32 i : Hull)
+    //{
+    //    BoundaryFlags[i] = true;
+    //}
 }
 
-void UDelaunatorObject::GetPointNeighboursBoundary(
-    TArray<int32>& OutNeighbourIndices,
-    int32 InTrianglePointIndex
-    ) const
+void UDelaunatorObject::UpdateInedges(const TArray<int32>& InTriangleIndices)
 {
     const TArray<int32>& InTriangles(GetTriangles());
     const TArray<int32>& InHalfEdges(GetHalfEdges());
 
-    if (! InTriangles.IsValidIndex(InTrianglePointIndex))
+    // Refresh incoming halfedges of modified triangles,
+    // keeping the exterior halfedge priority of hull points
+
+    for (int32 t : InTriangleIndices)
     {
-        return;
+        for (int32 e=t*3; e<(t*3+3); ++e)
+        {
+            const int32 p = InTriangles[((e%3) == 2) ? e-2 : e+1];
+            const int32 pe = Inedges[p];
+
+            if (InHalfEdges[e] == -1 ||
+                pe == -1 ||
+                pe >= InTriangles.Num() ||
+                InTriangles[((pe%3) == 2) ? pe-2 : pe+1] != p)
+            {
+                Inedges[p] = e;
+            }
+        }
     }
+}
 
-    int32 InitialTriangleIndex = InTrianglePointIndex/3;
+int32 UDelaunatorObject::FindWalkStartTriangle(const FVector2D& TargetPoint, int32 HintTriangle) const
+{
+    const TArray<int32>& InTriangles(GetTriangles());
+    const int32 PointCount = GetPoints().Num();
 
-    // Add initial triangle point next neighbour
+    // Jump-and-walk, start from the closest of a sparse point sample
 
-    OutNeighbourIndices.Emplace(
-        InTriangles[GetNextTriCorner(InitialTriangleIndex, InTrianglePointIndex)]
-        );
+    const int32 SampleCount = FMath::Max(1, FMath::FloorToInt(FMath::Pow(PointCount, 1.f/3.f)));
+    const int32 SampleStride = FMath::Max(1, PointCount / SampleCount);
 
-    // Start from initial point index and iterate CCW
+    int32 StartTriangle = 0;
+    float StartDistSq = BIG_NUMBER;
 
-    int32 HalfEdge = InHalfEdges[InTrianglePointIndex];
+    if (HintTriangle >= 0 && HintTriangle < GetTriangleCount())
+    {
+        StartTriangle = HintTriangle;
+        StartDistSq = (TargetPoint-GetPoints()[InTriangles[HintTriangle*3]]).SizeSquared();
+    }
 
-    while (HalfEdge >= 0)
+    // Point grid cell replaces the point sample when available
+
+    if (PointGrid.Num() > 0)
     {
-        int32 TriangleIndex = HalfEdge/3;
-        int32 PointIndex = GetNextTriCorner(TriangleIndex, HalfEdge);
+        const int32 GridPoint = PointGrid[FindPointGridCell(TargetPoint)];
 
-        // All point triangles visited, break
-        if (PointIndex == InTrianglePointIndex)
+        if (IsTriangulatedPoint(GridPoint) && (TargetPoint-GetPoints()[GridPoint]).SizeSquared() < StartDistSq)
         {
-            break;
+            StartTriangle = Inedges[GridPoint] / 3;
         }
 
-        // Add neighbour point
-        OutNeighbourIndices.Emplace(
-            InTriangles[GetNextTriCorner(TriangleIndex, PointIndex)]
-            );
+        return StartTriangle;
+    }
 
-        // Get corner of next triangle
-        HalfEdge = InHalfEdges[PointIndex];
+    for (int32 i=SampleStride/2; i<PointCount; i+=SampleStride)
+    {
+        if (Inedges[i] < 0)
+        {
+            continue;
+        }
+
+        const float DistSq = (TargetPoint-GetPoints()[i]).SizeSquared();
+
+        if (DistSq < StartDistSq)
+        {
+            StartTriangle = Inedges[i] / 3;
+            StartDistSq = DistSq;
+        }
     }
 
-    // All point triangles visited, return
-    if (HalfEdge >= 0)
+    return StartTriangle;
+}
+
+void UDelaunatorObject::InsertPoints(const TArray<FVector2D>& InPoints)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::InsertPoints);
+
+    if (InPoints.Num() < 1)
     {
         return;
     }
 
-    // Otherwise, iteration hit boundary edge,
-    // reverse iteration from initial point
+    // No existing triangulation, rebuild with all points
+    if (! IsValidDelaunatorObject() || GetTriangleCount() < 1)
+    {
+        TArray<FVector2D> NewPoints(GetPoints());
+        NewPoints.Append(InPoints);
+        UpdateFromPoints(MoveTemp(NewPoints));
+        return;
+    }
 
-    int32 ReverseInitialPoint = GetPrevTriCorner(InitialTriangleIndex, InTrianglePointIndex);
+    // Local edits also discard pending asynchronous results
+    ++BuildSerial;
 
-    // Add initial triangle point prev neighbour
+    DetachSharedPoints();
 
-    OutNeighbourIndices.Emplace(InTriangles[ReverseInitialPoint]);
+    const int32 StartIndex = Points.Num();
+    const int32 PointCount = StartIndex + InPoints.Num();
 
-    // Start from initial point index and iterate CW
+    Points.Append(InPoints);
 
-    HalfEdge = InHalfEdges[ReverseInitialPoint];
+    // Points might have been reallocated, rebind delaunator coordinates
+    Delaunator.coords = MakeArrayView(&Points.GetData()->X, PointCount*2);
 
-    while (HalfEdge >= 0)
+    Inedges.SetNumUninitialized(PointCount);
+    HullIndex.SetNumUninitialized(PointCount, false);
+    FMemory::Memset(Inedges.GetData()+StartIndex, ~0, InPoints.Num()*Inedges.GetTypeSize());
+    FMemory::Memset(HullIndex.GetData()+StartIndex, ~0, InPoints.Num()*HullIndex.GetTypeSize());
+
+    bool bHullChanged = false;
+    int32 HintTriangle = -1;
+
+    for (int32 i=StartIndex; i<PointCount; ++i)
     {
-        int32 TriangleIndex = HalfEdge/3;
-        int32 PointIndex = HalfEdge;
+        const int32 e = Delaunator.insert(i, FindWalkStartTriangle(Points[i], HintTriangle));
 
-        // Ensure no cyclic iteration
-        check(PointIndex != InTrianglePointIndex);
+        // Near-duplicate point, skip
+        if (e < 0)
+        {
+            continue;
+        }
 
-        int32 PrevPointIndex = GetPrevTriCorner(TriangleIndex, PointIndex);
+        HintTriangle = e / 3;
+        bHullChanged |= Delaunator.hull_touched;
+
+        UpdateInedges(Delaunator.touched);
+
+        // Keep grid walk starts local, rebuild once the point count
+        // outgrows the grid resolution for amortized O(1) upkeep
+
+        if (PointGrid.Num() > 0)
+        {
+            if (i > PointGrid.Num()*4)
+            {
+                UpdatePointGrid();
+            }
+            else
+            {
+                UpdatePointGridCell(i);
+            }
+        }
+    }
+
+    if (bHullChanged)
+    {
+        UpdateHull();
+    }
+
+    InvalidateNeighbourCache();
+    UpdateStats();
+}
+
+void UDelaunatorObject::RemovePoints(const TArray<int32>& InPointIndices)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::RemovePoints);
+
+    if (! IsValidDelaunatorObject())
+    {
+        return;
+    }
+
+    ++BuildSerial;
+
+    bool bHullChanged = false;
+
+    for (int32 i : InPointIndices)
+    {
+        // Skip invalid or already removed point
+        if (! GetPoints().IsValidIndex(i) || Inedges[i] < 0)
+        {
+            continue;
+        }
+
+        // Skip point whose removal would degenerate the triangulation
+        if (! Delaunator.remove(i, Inedges[i]))
+        {
+            UE_LOG(LogDel, Warning, TEXT("UDelaunatorObject::RemovePoints() - Unable to remove point %d"), i);
+            continue;
+        }
+
+        // Removed point keeps its index, marked by invalid incoming halfedge
+        Inedges[i] = -1;
+
+        bHullChanged |= Delaunator.hull_touched;
+
+        UpdateInedges(Delaunator.touched);
+    }
+
+    if (bHullChanged)
+    {
+        UpdateHull();
+    }
+
+    InvalidateNeighbourCache();
+    UpdateStats();
+}
+
+bool UDelaunatorObject::MovePoints(const TArray<int32>& InPointIndices, const TArray<FVector2D>& InPositions)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::MovePoints);
+
+    if (! IsValidDelaunatorObject() || InPointIndices.Num() != InPositions.Num())
+    {
+        return false;
+    }
+
+    ++BuildSerial;
+
+    DetachSharedPoints();
+
+    bool bResult = true;
+    bool bHullChanged = false;
+    int32 HintTriangle = -1;
+
+    for (int32 k=0; k<InPointIndices.Num(); ++k)
+    {
+        const int32 i = InPointIndices[k];
+        const FVector2D& Position(InPositions[k]);
+
+        if (! Points.IsValidIndex(i))
+        {
+            bResult = false;
+            continue;
+        }
+
+        // Point not in triangulation, only update position
+        if (Inedges[i] < 0)
+        {
+            Points[i] = Position;
+            continue;
+        }
+
+        // Triangles around point stay valid, restore delaunay condition with edge flips
+        if (Delaunator.check_star(Inedges[i], Position.X, Position.Y))
+        {
+            Points[i] = Position;
+            Delaunator.flip_star(Inedges[i]);
+            UpdateInedges(Delaunator.touched);
+            continue;
+        }
+
+        // Triangle inverted or hull point, remove and reinsert point.
+        // Removal fails when it would degenerate the triangulation,
+        // the point then keeps its previous position.
+
+        if (! Delaunator.remove(i, Inedges[i]))
+        {
+            UE_LOG(LogDel, Warning, TEXT("UDelaunatorObject::MovePoints() - Unable to move point %d"), i);
+            bResult = false;
+            continue;
+        }
+
+        Inedges[i] = -1;
+        bHullChanged |= Delaunator.hull_touched;
+        UpdateInedges(Delaunator.touched);
+
+        Points[i] = Position;
+
+        const int32 e = Delaunator.insert(i, FindWalkStartTriangle(Position, HintTriangle));
+
+        // Moved onto another point, point is no longer triangulated
+        if (e < 0)
+        {
+            continue;
+        }
+
+        HintTriangle = e / 3;
+        bHullChanged |= Delaunator.hull_touched;
+        UpdateInedges(Delaunator.touched);
+    }
+
+    if (bHullChanged)
+    {
+        UpdateHull();
+    }
+
+    InvalidateNeighbourCache();
+    UpdateStats();
+
+    return bResult;
+}
+
+void UDelaunatorObject::RenumberPointsSpatially(TArray<int32>& OutPointOrder)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::RenumberPointsSpatially);
+
+    OutPointOrder.Reset();
+
+    if (! IsValidDelaunatorObject())
+    {
+        return;
+    }
+
+    ++BuildSerial;
+
+    delaunator::hilbert_order(Delaunator.coords, OutPointOrder);
+
+    TArray<FVector2D> SortedPoints;
+    SortedPoints.SetNumUninitialized(GetPoints().Num());
+
+    for (int32 i=0; i<OutPointOrder.Num(); ++i)
+    {
+        SortedPoints[i] = GetPoints()[OutPointOrder[i]];
+    }
+
+    Points = MoveTemp(SortedPoints);
+    SharedPoints.Reset();
+
+    Delaunator.renumber(OutPointOrder);
+    Delaunator.coords = MakeArrayView(&Points.GetData()->X, Points.Num()*2);
+
+    // Owned point values follow their points
+
+    for (const FName& ValueName : PointValueNames)
+    {
+        UDelaunatorValueObject* ValueObject = GetValueObject(ValueName);
+
+        if (ValueObject && ValueObject->IsValidElementCount(OutPointOrder.Num()))
+        {
+            ValueObject->RemapValues(OutPointOrder);
+        }
+    }
+
+    UpdateTopology();
+}
+
+void UDelaunatorObject::CopyIndices(TArray<int32>& OutTriangles, TArray<int32>& OutHalfEdges)
+{
+    OutTriangles = Delaunator.triangles;
+    OutHalfEdges = Delaunator.halfedges;
+}
+
+UDelaunatorValueObject* UDelaunatorObject::CreateDefaultValueObject(
+    UObject* Outer,
+    FName ValueName,
+    TSubclassOf<UDelaunatorValueObject> ValueType
+    )
+{
+    if (! IsValidDelaunatorObject() || ValueName.IsNone())
+    {
+        return nullptr;
+    }
+
+    UDelaunatorValueObject* ValueObject = GetValueObject(ValueName);
+
+    if (! IsValid(ValueObject))
+    {
+        ValueObject = NewObject<UDelaunatorValueObject>(Outer, ValueType);
+        ValueMap.Emplace(ValueName, ValueObject);
+    }
+
+    return ValueObject;
+}
+
+UDelaunatorValueObject* UDelaunatorObject::CreateDefaultPointValueObject(
+    FName ValueName,
+    TSubclassOf<UDelaunatorValueObject> ValueType
+    )
+{
+    UDelaunatorValueObject* ValueObject = CreateDefaultValueObject(
+        ValueName,
+        ValueType
+        );
+
+    if (IsValid(ValueObject))
+    {
+        ValueObject->InitializeValues(GetPointCount());
+        PointValueNames.Emplace(ValueName);
+    }
+
+    return ValueObject;
+}
+
+UDelaunatorValueObject* UDelaunatorObject::CreateDefaultTriangleValueObject(
+    FName ValueName,
+    TSubclassOf<UDelaunatorValueObject> ValueType
+    )
+{
+    UDelaunatorValueObject* ValueObject = CreateDefaultValueObject(
+        ValueName,
+        ValueType
+        );
+
+    if (IsValid(ValueObject))
+    {
+        ValueObject->InitializeValues(GetTriangleCount());
+        PointValueNames.Remove(ValueName);
+    }
+
+    return ValueObject;
+}
+
+void UDelaunatorObject::ResetPointValueObject(UDelaunatorValueObject* ValueObject)
+{
+    if (IsValid(ValueObject))
+    {
+        ValueObject->InitializeValues(GetPointCount());
+    }
+}
+
+void UDelaunatorObject::ResetTriangleValueObject(UDelaunatorValueObject* ValueObject)
+{
+    if (IsValid(ValueObject))
+    {
+        ValueObject->InitializeValues(GetTriangleCount());
+    }
+}
+
+int32 UDelaunatorObject::FindPointByValue(UDelaunatorCompareOperator* CompareOperator)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPointByValue);
+
+    return IsValid(CompareOperator)
+        ? CompareOperator->GetResult(GetPointCount())
+        : -1;
+}
+
+void UDelaunatorObject::FindPointsByValue(
+    TArray<int32>& OutPointIndices,
+    UDelaunatorCompareOperator* CompareOperator
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPointsByValue);
+
+    if (IsValid(CompareOperator))
+    {
+        CompareOperator->GetResults(OutPointIndices, GetPointCount());
+    }
+}
+
+void UDelaunatorObject::FindTrianglesByValue(
+    TArray<int32>& OutTriangleIndices,
+    UDelaunatorCompareOperator* CompareOperator
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindTrianglesByValue);
+
+    if (IsValid(CompareOperator))
+    {
+        CompareOperator->GetResults(OutTriangleIndices, GetTriangleCount());
+    }
+}
+
+// Query Utility
+
+void UDelaunatorObject::GetTrianglesByPointIndices(
+    TArray<int32>& OutTriangles,
+    const TArray<int32>& InPointIndices,
+    bool bInverseResult
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::GetTrianglesByPointIndices);
+
+    OutTriangles.Reset();
+
+    // Invalid delaunator object, abort
+    if (! IsValidDelaunatorObject())
+    {
+        return;
+    }
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+    const int32 TriangleCount = GetTriangleCount();
+
+    // Generate valid point index set
+    TSet<int32> PointIndexSet(InPointIndices.FilterByPredicate(
+        [&InPoints](const int32& PointIndex)
+        {
+            return InPoints.IsValidIndex(PointIndex);
+        } ) );
+
+    // No valid point index, abort
+    if (PointIndexSet.Num() < 1)
+    {
+        return;
+    }
+
+    // Gather all triangles that consist of any of the point indices
+    if (! bInverseResult)
+    {
+        for (int32 ti=0; ti<TriangleCount; ++ti)
+        {
+            int32 i = ti*3;
+
+            if (PointIndexSet.Contains(InTriangles[i  ]) ||
+                PointIndexSet.Contains(InTriangles[i+1]) ||
+                PointIndexSet.Contains(InTriangles[i+2]))
+            {
+                OutTriangles.Emplace(ti);
+            }
+        }
+    }
+    else
+    {
+        for (int32 ti=0; ti<TriangleCount; ++ti)
+        {
+            int32 i = ti*3;
+
+            if (PointIndexSet.Contains(InTriangles[i  ]) ||
+                PointIndexSet.Contains(InTriangles[i+1]) ||
+                PointIndexSet.Contains(InTriangles[i+2]))
+            {
+                continue;
+            }
+
+            OutTriangles.Emplace(ti);
+        }
+    }
+}
+
+void UDelaunatorObject::GetTrianglesByEdgeIndices(
+    TArray<int32>& OutTriangles,
+    const TArray<int32>& InPointIndices,
+    bool bInverseResult
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::GetTrianglesByEdgeIndices);
+
+    OutTriangles.Reset();
+
+    // Invalid delaunator object, abort
+    if (! IsValidDelaunatorObject())
+    {
+        return;
+    }
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+    const int32 TriangleCount = GetTriangleCount();
+
+    // Generate valid point index set
+    TSet<int32> PointIndexSet(InPointIndices.FilterByPredicate(
+        [&InPoints](const int32& PointIndex)
+        {
+            return InPoints.IsValidIndex(PointIndex);
+        } ) );
+
+    // No valid point index, abort
+    if (PointIndexSet.Num() < 1)
+    {
+        return;
+    }
+
+    // Gather all triangles that consist of any of the point indices
+    if (! bInverseResult)
+    {
+        for (int32 ti=0; ti<TriangleCount; ++ti)
+        {
+            int32 i = ti*3;
+            bool bInSet0 = PointIndexSet.Contains(InTriangles[i  ]);
+            bool bInSet1 = PointIndexSet.Contains(InTriangles[i+1]);
+            bool bInSet2 = PointIndexSet.Contains(InTriangles[i+2]);
+
+            if ((bInSet0 && bInSet1) ||
+                (bInSet0 && bInSet2) ||
+                (bInSet1 && bInSet2))
+            {
+                OutTriangles.Emplace(ti);
+            }
+        }
+    }
+    else
+    {
+        for (int32 ti=0; ti<TriangleCount; ++ti)
+        {
+            int32 i = ti*3;
+            bool bInSet0 = PointIndexSet.Contains(InTriangles[i  ]);
+            bool bInSet1 = PointIndexSet.Contains(InTriangles[i+1]);
+            bool bInSet2 = PointIndexSet.Contains(InTriangles[i+2]);
+
+            if ((bInSet0 && bInSet1) ||
+                (bInSet0 && bInSet2) ||
+                (bInSet1 && bInSet2))
+            {
+                continue;
+            }
+
+            OutTriangles.Emplace(ti);
+        }
+    }
+}
+
+void UDelaunatorObject::GetPointNeighbours(TArray<int32>& OutNeighbourIndices, int32 PointIndex) const
+{
+    check(IsValidDelaunatorObject());
+
+    OutNeighbourIndices.Reset();
+
+    if (HasNeighbourCache())
+    {
+        OutNeighbourIndices.Append(GetPointNeighboursView(PointIndex));
+        return;
+    }
+
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
+    const TArray<int32>& InInedges(GetInedges());
+
+    const int32 e0 = InInedges[PointIndex];
+
+    // coincident point, skip
+    if (e0 == -1)
+    {
+        return;
+    }
+
+    // Iterate over point triangles
+
+    int32 e = e0;
+    do
+    {
+        const int32 t = e / 3;
+        const int32 f = t * 3;
+
+        OutNeighbourIndices.Emplace(InTriangles[e]);
+
+        e = ((e-f) < 2) ? e+1 : f;
+
+        // Ensure sane triangulation
+        check(PointIndex == InTriangles[e]);
+
+        e = InHalfEdges[e];
+    }
+    while (e != e0 && e != -1);
+}
+
+void UDelaunatorObject::GetPointNeighbours(TArray<int32>& OutNeighbourIndices, TArray<int32>& OutNeighbourTriangles, int32 PointIndex) const
+{
+    check(IsValidDelaunatorObject());
+
+    OutNeighbourIndices.Reset();
+    OutNeighbourTriangles.Reset();
+
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
+    const TArray<int32>& InInedges(GetInedges());
+
+    const int32 e0 = InInedges[PointIndex];
+
+    // coincident point, skip
+    if (e0 == -1)
+    {
+        return;
+    }
+
+    // Iterate over point triangles
+
+    int32 e = e0;
+    do
+    {
+        const int32 t = e / 3;
+        const int32 f = t * 3;
+
+        OutNeighbourIndices.Emplace(InTriangles[e]);
+        OutNeighbourTriangles.Emplace(t);
+
+        e = ((e-f) < 2) ? e+1 : f;
+
+        // Ensure sane triangulation
+        check(PointIndex == InTriangles[e]);
+
+        e = InHalfEdges[e];
+    }
+    while (e != e0 && e != -1);
+}
+
+// Boundary Utility
+
+void UDelaunatorObject::GetPointTrianglesBoundary(
+    TArray<int32>& OutTriangleIndices,
+    int32 InTrianglePointIndex
+    ) const
+{
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
+
+    if (! InTriangles.IsValidIndex(InTrianglePointIndex))
+    {
+        return;
+    }
+
+    int32 InitialTriangleIndex = InTrianglePointIndex/3;
+
+    // Add initial triangle
+    OutTriangleIndices.Emplace(InitialTriangleIndex);
+
+    // Start from initial point index and iterate CCW
+
+    int32 HalfEdge = InHalfEdges[InTrianglePointIndex];
+
+    while (HalfEdge >= 0)
+    {
+        int32 TriangleIndex = HalfEdge/3;
+        int32 PointIndex = GetNextTriCorner(TriangleIndex, HalfEdge);
+
+        // All point triangles visited, break
+        if (PointIndex == InTrianglePointIndex)
+        {
+            break;
+        }
+
+        // Add next triangle
+        OutTriangleIndices.Emplace(TriangleIndex);
+
+        // Get corner of next triangle
+        HalfEdge = InHalfEdges[PointIndex];
+    }
+
+    // All point triangles visited, return
+    if (HalfEdge >= 0)
+    {
+        return;
+    }
+
+    // Start from initial point index and iterate CW
+
+    HalfEdge = InHalfEdges[GetPrevTriCorner(InitialTriangleIndex, InTrianglePointIndex)];
+
+    while (HalfEdge >= 0)
+    {
+        int32 TriangleIndex = HalfEdge/3;
+        int32 PointIndex = HalfEdge;
+
+        // Ensure no cyclic iteration
+        check(PointIndex != InTrianglePointIndex);
+
+        // Add prev triangle
+        OutTriangleIndices.Emplace(TriangleIndex);
+
+        // Get corner of prev triangle
+        HalfEdge = InHalfEdges[GetPrevTriCorner(TriangleIndex, PointIndex)];
+    }
+}
+
+void UDelaunatorObject::GetPointNeighboursBoundary(
+    TArray<int32>& OutNeighbourIndices,
+    int32 InTrianglePointIndex
+    ) const
+{
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
+
+    if (! InTriangles.IsValidIndex(InTrianglePointIndex))
+    {
+        return;
+    }
+
+    int32 InitialTriangleIndex = InTrianglePointIndex/3;
+
+    // Add initial triangle point next neighbour
+
+    OutNeighbourIndices.Emplace(
+        InTriangles[GetNextTriCorner(InitialTriangleIndex, InTrianglePointIndex)]
+        );
+
+    // Start from initial point index and iterate CCW
+
+    int32 HalfEdge = InHalfEdges[InTrianglePointIndex];
+
+    while (HalfEdge >= 0)
+    {
+        int32 TriangleIndex = HalfEdge/3;
+        int32 PointIndex = GetNextTriCorner(TriangleIndex, HalfEdge);
+
+        // All point triangles visited, break
+        if (PointIndex == InTrianglePointIndex)
+        {
+            break;
+        }
+
+        // Add neighbour point
+        OutNeighbourIndices.Emplace(
+            InTriangles[GetNextTriCorner(TriangleIndex, PointIndex)]
+            );
+
+        // Get corner of next triangle
+        HalfEdge = InHalfEdges[PointIndex];
+    }
+
+    // All point triangles visited, return
+    if (HalfEdge >= 0)
+    {
+        return;
+    }
+
+    // Otherwise, iteration hit boundary edge,
+    // reverse iteration from initial point
+
+    int32 ReverseInitialPoint = GetPrevTriCorner(InitialTriangleIndex, InTrianglePointIndex);
+
+    // Add initial triangle point prev neighbour
+
+    OutNeighbourIndices.Emplace(InTriangles[ReverseInitialPoint]);
+
+    // Start from initial point index and iterate CW
+
+    HalfEdge = InHalfEdges[ReverseInitialPoint];
+
+    while (HalfEdge >= 0)
+    {
+        int32 TriangleIndex = HalfEdge/3;
+        int32 PointIndex = HalfEdge;
+
+        // Ensure no cyclic iteration
+        check(PointIndex != InTrianglePointIndex);
+
+        int32 PrevPointIndex = GetPrevTriCorner(TriangleIndex, PointIndex);
+
+        // Add neighbour point
+        OutNeighbourIndices.Emplace(InTriangles[PrevPointIndex]);
+
+        // Get corner of prev triangle
+        HalfEdge = InHalfEdges[PrevPointIndex];
+    }
+}
+
+void UDelaunatorObject::FindTrianglesBetweenPoints(
+    TArray<int32>& OutTriangleIndices,
+    int32 PointIndex0,
+    int32 PointIndex1
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindTrianglesBetweenPoints);
+
+    OutTriangleIndices.Reset();
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
+
+    if (! IsValidDelaunatorObject()          ||
+        ! InPoints.IsValidIndex(PointIndex0) ||
+        ! InPoints.IsValidIndex(PointIndex1))
+    {
+        return;
+    }
+
+    // Find initial triangle
+
+    const int32 TriCount = InTriangles.Num() / 3;
+    int32 InitialTrianglePoint = GetTrianglePointIndex(PointIndex0);
+
+    // No valid triangle found, abort
+    if (InitialTrianglePoint < 0)
+    {
+        return;
+    }
+
+    // Find triangles connected to PointIndex0
+    TArray<int32> InitialTriangles;
+    GetPointTriangles(InitialTriangles, InitialTrianglePoint);
+
+    check(InitialTriangles.Num() > 0);
+
+    // Search for target point on initial triangles.
+    // If found, add the triangle then return.
+    for (int32 ti : InitialTriangles)
+    {
+        if (FindCornerIndex(ti, PointIndex1) >= 0)
+        {
+            OutTriangleIndices.Emplace(ti);
+            return;
+        }
+    }
+
+    // Find initial segment intersecting triangle
+
+    const FVector2D& P0(InPoints[PointIndex0]);
+    const FVector2D& P1(InPoints[PointIndex1]);
+
+    int32* StartTriangle = InitialTriangles.FindByPredicate(
+        [&](const int32 ti)
+        {
+            int32 pi = FindCornerIndex(ti, PointIndex0);
+            return pi >= 0
+                ? HasOppositeSideSegmentIntersection(P0, P1, ti, pi)
+                : false;
+        } );
+
+    // No triangle side segment intersection, abort
+    if (! StartTriangle)
+    {
+        return;
+    }
+
+    enum { SEARCH_LIMIT = 100 };
+
+    int32 pi = FindCornerIndex(*StartTriangle, PointIndex0);
+
+    for (int32 i=0; i<SEARCH_LIMIT; ++i)
+    {
+        int32 ti = pi/3;
+
+        OutTriangleIndices.Emplace(ti);
+
+        if (FindCornerIndex(ti, PointIndex1) >= 0)
+        {
+            break;
+        }
+
+        pi = GetNextTriCorner(ti, pi);
+        pi = FindSegmentClippingSide(P0, P1, ti, pi);
+
+        //if (pi < 0)
+        //{
+        //    break;
+        //}
+        check(pi >= 0);
+
+        pi = InHalfEdges[pi];
+
+        //if (pi < 0)
+        //{
+        //    break;
+        //}
+        check(pi >= 0);
+    }
+}
+
+bool UDelaunatorObject::FindBoundaryPoints(
+    TArray<int32>& OutPointIndices,
+    const TArray<int32>& InBoundaryTriangles,
+    int32 BoundaryPoint0,
+    int32 BoundaryPoint1
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindBoundaryPoints);
+
+    OutPointIndices.Reset();
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+
+    if (! IsValidDelaunatorObject()             ||
+        ! InPoints.IsValidIndex(BoundaryPoint0) ||
+        ! InPoints.IsValidIndex(BoundaryPoint1) ||
+        BoundaryPoint0 == BoundaryPoint1        ||
+        InBoundaryTriangles.Num() < 1)
+    {
+        return false;
+    }
+
+    // Single boundary triangle, check if both boundary point is in the triangle
+    if (InBoundaryTriangles.Num() == 1)
+    {
+        int32 ti = InBoundaryTriangles[0];
+        int32 pi0 = FindCornerIndex(ti, BoundaryPoint0);
+        int32 pi1 = FindCornerIndex(ti, BoundaryPoint1);
+
+        // Both boundary points is in triangle, add as output indices then return
+        if (pi0 >=0 && pi1 >= 0)
+        {
+            int32 iNext = GetNextTriCorner(ti, pi0);
+            int32 iPrev = GetPrevTriCorner(ti, pi0);
+            int32 iMid = iNext == pi1 ? iPrev : iNext;
+
+            OutPointIndices.Emplace(BoundaryPoint0);
+            OutPointIndices.Emplace(InTriangles[iMid]);
+            OutPointIndices.Emplace(BoundaryPoint1);
+
+            return true;
+        }
+        // Triangle does not contain both boundary points, abort
+        else
+        {
+            return false;
+        }
+    }
+
+    const FVector2D& BP0(InPoints[BoundaryPoint0]);
+    const FVector2D& BP1(InPoints[BoundaryPoint1]);
+    const FVector2D DBP01 = BP1-BP0;
+    const FVector2D CBP01(-DBP01.Y, DBP01.X);
+
+    TArray<int32> PointIndices;
+
+    int32 It = BoundaryPoint0;
+    int32 ti = InBoundaryTriangles[0];
+    int32 pi = FindCornerIndex(ti, It);
+
+    if (pi < 0)
+    {
+        return false;
+    }
+
+    PointIndices.Emplace(It);
+
+    for (int32 i=0; i<(InBoundaryTriangles.Num()-1); ++i)
+    {
+        ti = InBoundaryTriangles[i];
+        pi = FindCornerIndex(ti, It);
+
+        if (pi < 0)
+        {
+            return false;
+        }
+
+        int32 iNext = GetNextTriCorner(ti, pi);
+        int32 iPrev = GetPrevTriCorner(ti, pi);
+
+        const FVector2D& PNext(InPoints[InTriangles[iNext]]);
+        const FVector2D& PPrev(InPoints[InTriangles[iPrev]]);
+
+        const float DotNext = (PNext-BP0) | CBP01;
+        const float DotPrev = (PPrev-BP0) | CBP01;
+
+        if (DotNext >= 0.f && DotPrev >= 0.f)
+        {
+            if (DotNext > DotPrev)
+            {
+                It = InTriangles[iNext];
+            }
+            else
+            {
+                It = InTriangles[iPrev];
+            }
+        }
+        else
+        if (DotNext >= 0.f)
+        {
+            It = InTriangles[iNext];
+        }
+        else
+        if (DotPrev >= 0.f)
+        {
+            It = InTriangles[iPrev];
+        }
+
+        if (PointIndices.Num() == 0 || PointIndices.Last() != It)
+        {
+            PointIndices.Emplace(It);
+        }
+    }
+
+    It = BoundaryPoint1;
+
+    // Check if last triangle have BoundaryPoint1
+    if (FindCornerIndex(InBoundaryTriangles.Last(), It) >= 0)
+    {
+        PointIndices.Emplace(BoundaryPoint1);
+        OutPointIndices = MoveTemp(PointIndices);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool UDelaunatorObject::FindPolyBoundaryTriangles(
+    TArray<int32>& OutTriangles,
+    const TArray<int32>& InPolyPointIndices,
+    bool bClosedPoly,
+    bool bAllowDirectConnection
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPolyBoundaryTriangles);
+
+    OutTriangles.Reset();
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+
+    if (! IsValidDelaunatorObject()                     ||
+        (! bClosedPoly && InPolyPointIndices.Num() < 2) ||
+        (  bClosedPoly && InPolyPointIndices.Num() < 3))
+    {
+        return false;
+    }
+
+    check(InPoints.IsValidIndex(InPolyPointIndices[0]));
+    check(InPoints.IsValidIndex(InPolyPointIndices.Last()));
+
+    const FVector2D& P0(InPoints[InPolyPointIndices[0]]);
+    const FVector2D& PN(InPoints[InPolyPointIndices.Last()]);
+
+    TArray<int32> BoundaryTriangles;
+
+    const int32 PolyPointCount = InPolyPointIndices.Num();
+    const int32 PointItCount = (! bClosedPoly || P0.Equals(PN))
+        ? PolyPointCount-1
+        : PolyPointCount;
+
+    // Find all triangles between boundary poly
+    for (int32 i=0; i<PointItCount; ++i)
+    {
+        int32 i0 = i;
+        int32 i1 = i+1;
+
+        if (i1 == PolyPointCount)
+        {
+            i1 = 0;
+        }
+
+        int32 pi0 = InPolyPointIndices[i0];
+        int32 pi1 = InPolyPointIndices[i1];
+
+        // Invalid input points, abort
+        if (! InPoints.IsValidIndex(pi0) ||
+            ! InPoints.IsValidIndex(pi1))
+        {
+            return false;
+        }
+
+        // Find triangles between polyline
+
+        TArray<int32> TrianglesBetweenPoints;
+
+        FindTrianglesBetweenPoints(
+            TrianglesBetweenPoints,
+            pi0,
+            pi1
+            );
+
+        // Poly line have direct connection within single triangle, skip
+        if (!bAllowDirectConnection && TrianglesBetweenPoints.Num() == 1)
+        {
+            continue;
+        }
+
+        // Add triangle between points as boundary triangles
+        BoundaryTriangles.Append(TrianglesBetweenPoints);
+    }
+
+    // Find all boundary triangles out of poly
+    {
+        TArray<FVector2D> PolyPoints;
+        TSet<int32> BoundarySet(InPolyPointIndices);
+
+        PolyPoints.SetNumUninitialized(InPolyPointIndices.Num());
+
+        for (int32 i=0; i<InPolyPointIndices.Num(); ++i)
+        {
+            PolyPoints[i] = InPoints[InPolyPointIndices[i]];
+        }
+
+        const int32 TriangleCount = GetTriangleCount();
+
+        for (int32 ti=0; ti<TriangleCount; ++ti)
+        {
+            int32 i = ti*3;
+            int32 pi0 = InTriangles[i  ];
+            int32 pi1 = InTriangles[i+1];
+            int32 pi2 = InTriangles[i+2];
+
+            // Triangle consists of boundary points
+            if (BoundarySet.Contains(pi0) &&
+                BoundarySet.Contains(pi1) &&
+                BoundarySet.Contains(pi2))
+            {
+                FVector2D TriCenter =
+                    (InPoints[pi0] + InPoints[pi1] + InPoints[pi2]) / 3.f;
+
+                // Triangle center is outside of poly, mark as boundary triangle
+                if (! UGULPolyUtilityLibrary::IsPointOnPoly(TriCenter, PolyPoints))
+                {
+                    BoundaryTriangles.Emplace(ti);
+                }
+            }
+        }
+    }
+
+    OutTriangles = TSet<int32>(BoundaryTriangles).Array();
+
+    return true;
+}
+
+bool UDelaunatorObject::FindPolyGroupsBoundaryTriangles(
+    TArray<int32>& OutTriangles,
+    const TArray<FGULIntGroup>& InPolyBoundaryGroups,
+    bool bClosedPoly,
+    bool bAllowDirectConnection
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPolyGroupsBoundaryTriangles);
+
+    OutTriangles.Reset();
+
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const TArray<int32>& InTriangles(GetTriangles());
+
+    if (! IsValidDelaunatorObject()   ||
+        InPolyBoundaryGroups.Num() < 1)
+    {
+        return false;
+    }
+
+    TArray<int32> BoundaryTriangles;
+
+    for (const FGULIntGroup& PolyBoundaryGroup : InPolyBoundaryGroups)
+    {
+        const TArray<int32>& PolyIndices(PolyBoundaryGroup.Values);
+
+        if ((! bClosedPoly && PolyIndices.Num() < 2) ||
+            (  bClosedPoly && PolyIndices.Num() < 3))
+        {
+            continue;
+        }
+
+        check(InPoints.IsValidIndex(PolyIndices[0]));
+        check(InPoints.IsValidIndex(PolyIndices.Last()));
+
+        const FVector2D& P0(InPoints[PolyIndices[0]]);
+        const FVector2D& PN(InPoints[PolyIndices.Last()]);
+
+        const int32 PolyPointCount = PolyIndices.Num();
+        const int32 PointItCount = (! bClosedPoly || P0.Equals(PN))
+            ? PolyPointCount-1
+            : PolyPointCount;
+
+        for (int32 i=0; i<PointItCount; ++i)
+        {
+            int32 i0 = i;
+            int32 i1 = i+1;
+
+            if (i1 == PolyPointCount)
+            {
+                i1 = 0;
+            }
+
+            int32 pi0 = PolyIndices[i0];
+            int32 pi1 = PolyIndices[i1];
+
+            // Invalid input points, abort
+            if (! InPoints.IsValidIndex(pi0) ||
+                ! InPoints.IsValidIndex(pi1))
+            {
+                return false;
+            }
+
+            // Find triangles between polyline
+
+            TArray<int32> TrianglesBetweenPoints;
+
+            FindTrianglesBetweenPoints(
+                TrianglesBetweenPoints,
+                pi0,
+                pi1
+                );
+
+            // Poly line have direct connection within single triangle, skip
+            if (!bAllowDirectConnection && TrianglesBetweenPoints.Num() == 1)
+            {
+                continue;
+            }
+
+            // Add triangle between points as boundary triangles
+            BoundaryTriangles.Append(TrianglesBetweenPoints);
+        }
+    }
+
+    // Remove all triangles out of poly
+
+    TArray<FGULVector2DGroup> BoundaryPolyGroups;
+    TSet<int32> BoundarySet;
+
+    // Gather poly boundary points and index set
+    for (const FGULIntGroup& PolyBoundaryGroup : InPolyBoundaryGroups)
+    {
+        const TArray<int32>& PolyIndices(PolyBoundaryGroup.Values);
+        const int32 PointCount = PolyIndices.Num();
+
+        BoundaryPolyGroups.AddDefaulted();
+        
+        TArray<FVector2D>& BoundaryPoints(BoundaryPolyGroups.Last().Points);
+        BoundaryPoints.SetNumUninitialized(PointCount);
+
+        for (int32 i=0; i<PointCount; ++i)
+        {
+            BoundaryPoints[i] = InPoints[PolyIndices[i]];
+        }
+
+        BoundarySet.Append(PolyIndices);
+    }
+
+    // Find all boundary triangles out of poly
+
+    const int32 TriangleCount = GetTriangleCount();
+
+    for (int32 ti=0; ti<TriangleCount; ++ti)
+    {
+        int32 i = ti*3;
+        int32 pi0 = InTriangles[i  ];
+        int32 pi1 = InTriangles[i+1];
+        int32 pi2 = InTriangles[i+2];
+
+        // Triangle consists of boundary points
+        if (BoundarySet.Contains(pi0) &&
+            BoundarySet.Contains(pi1) &&
+            BoundarySet.Contains(pi2))
+        {
+            FVector2D TriCenter =
+                (InPoints[pi0] + InPoints[pi1] + InPoints[pi2]) / 3.f;
+
+            for (const FGULVector2DGroup& PolyGroup : BoundaryPolyGroups)
+            {
+                bool bPointOnPoly = UGULPolyUtilityLibrary::IsPointOnPoly(
+                    TriCenter,
+                    PolyGroup.Points
+                    );
+
+                // Triangle center is outside of poly,
+                // mark as boundary triangle
+                if (! bPointOnPoly)
+                {
+                    BoundaryTriangles.Emplace(ti);
+                    break;
+                }
+            }
+        }
+    }
 
-        // Add neighbour point
-        OutNeighbourIndices.Emplace(InTriangles[PrevPointIndex]);
+    OutTriangles = TSet<int32>(BoundaryTriangles).Array();
 
-        // Get corner of prev triangle
-        HalfEdge = InHalfEdges[PrevPointIndex];
-    }
+    return true;
 }
 
-void UDelaunatorObject::FindTrianglesBetweenPoints(
-    TArray<int32>& OutTriangleIndices,
-    int32 PointIndex0,
-    int32 PointIndex1
-    )
+bool UDelaunatorObject::InsertConstraints(const TArray<FGULIntGroup>& InPolyGroups, bool bClosedPoly)
 {
-    OutTriangleIndices.Reset();
-
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
-    const TArray<int32>& InHalfEdges(GetHalfEdges());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::InsertConstraints);
 
-    if (! IsValidDelaunatorObject()          ||
-        ! InPoints.IsValidIndex(PointIndex0) ||
-        ! InPoints.IsValidIndex(PointIndex1))
+    if (! IsValidDelaunatorObject())
     {
-        return;
+        return false;
     }
 
-    // Find initial triangle
+    ++BuildSerial;
 
-    const int32 TriCount = InTriangles.Num() / 3;
-    int32 InitialTrianglePoint = GetTrianglePointIndex(PointIndex0);
+    bool bResult = true;
 
-    // No valid triangle found, abort
-    if (InitialTrianglePoint < 0)
+    for (const FGULIntGroup& PolyGroup : InPolyGroups)
     {
-        return;
-    }
+        const TArray<int32>& PolyIndices(PolyGroup.Values);
+        const int32 PolyPointCount = PolyIndices.Num();
 
-    // Find triangles connected to PointIndex0
-    TArray<int32> InitialTriangles;
-    GetPointTriangles(InitialTriangles, InitialTrianglePoint);
+        if (PolyPointCount < 2)
+        {
+            continue;
+        }
 
-    check(InitialTriangles.Num() > 0);
+        const int32 PointItCount = (! bClosedPoly || PolyIndices[0] == PolyIndices.Last())
+            ? PolyPointCount-1
+            : PolyPointCount;
 
-    // Search for target point on initial triangles.
-    // If found, add the triangle then return.
-    for (int32 ti : InitialTriangles)
-    {
-        if (FindCornerIndex(ti, PointIndex1) >= 0)
+        for (int32 i=0; i<PointItCount; ++i)
         {
-            OutTriangleIndices.Emplace(ti);
-            return;
+            const int32 pi0 = PolyIndices[i];
+            const int32 pi1 = PolyIndices[(i+1) % PolyPointCount];
+
+            // Invalid or non-triangulated segment points, skip segment
+            if (! GetPoints().IsValidIndex(pi0)   ||
+                ! GetPoints().IsValidIndex(pi1)   ||
+                ! IsTriangulatedPoint(pi0)   ||
+                ! IsTriangulatedPoint(pi1))
+            {
+                bResult = false;
+                continue;
+            }
+
+            if (pi0 == pi1)
+            {
+                continue;
+            }
+
+            bResult &= Delaunator.constrain(pi0, Inedges[pi0], pi1);
+
+            UpdateInedges(Delaunator.touched);
         }
     }
 
-    // Find initial segment intersecting triangle
+    InvalidateNeighbourCache();
+    UpdateStats();
 
-    const FVector2D& P0(InPoints[PointIndex0]);
-    const FVector2D& P1(InPoints[PointIndex1]);
+    return bResult;
+}
 
-    int32* StartTriangle = InitialTriangles.FindByPredicate(
-        [&](const int32 ti)
-        {
-            int32 pi = FindCornerIndex(ti, PointIndex0);
-            return pi >= 0
-                ? HasOppositeSideSegmentIntersection(P0, P1, ti, pi)
-                : false;
-        } );
+void UDelaunatorObject::GetConstrainedRegionDepths(TArray<int32>& OutDepths) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::GetConstrainedRegionDepths);
 
-    // No triangle side segment intersection, abort
-    if (! StartTriangle)
+    if (IsValidDelaunatorObject())
     {
-        return;
+        Delaunator.get_region_depths(OutDepths);
     }
+    else
+    {
+        OutDepths.Reset();
+    }
+}
 
-    enum { SEARCH_LIMIT = 100 };
-
-    int32 pi = FindCornerIndex(*StartTriangle, PointIndex0);
+void UDelaunatorObject::FindConstrainedPolyTriangles(TArray<int32>& OutInnerTriangles, TArray<int32>& OutOuterTriangles) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindConstrainedPolyTriangles);
 
-    for (int32 i=0; i<SEARCH_LIMIT; ++i)
-    {
-        int32 ti = pi/3;
+    OutInnerTriangles.Reset();
+    OutOuterTriangles.Reset();
 
-        OutTriangleIndices.Emplace(ti);
+    TArray<int32> Depths;
+    GetConstrainedRegionDepths(Depths);
 
-        if (FindCornerIndex(ti, PointIndex1) >= 0)
+    for (int32 ti=0; ti<Depths.Num(); ++ti)
+    {
+        if (Depths[ti] & 1)
         {
-            break;
+            OutInnerTriangles.Emplace(ti);
         }
+        else
+        {
+            OutOuterTriangles.Emplace(ti);
+        }
+    }
+}
 
-        pi = GetNextTriCorner(ti, pi);
-        pi = FindSegmentClippingSide(P0, P1, ti, pi);
-
-        //if (pi < 0)
-        //{
-        //    break;
-        //}
-        check(pi >= 0);
+UDelaunatorVoronoi* UDelaunatorObject::GenerateVoronoiDual()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::GenerateVoronoiDual);
 
-        pi = InHalfEdges[pi];
+    UDelaunatorVoronoi* Voronoi = NewObject<UDelaunatorVoronoi>(this);
 
-        //if (pi < 0)
-        //{
-        //    break;
-        //}
-        check(pi >= 0);
+    if (IsValid(Voronoi))
+    {
+        Voronoi->GenerateFrom(this);
     }
+
+    return Voronoi;
 }
 
-bool UDelaunatorObject::FindBoundaryPoints(
-    TArray<int32>& OutPointIndices,
-    const TArray<int32>& InBoundaryTriangles,
-    int32 BoundaryPoint0,
-    int32 BoundaryPoint1
-    )
+void UDelaunatorObject::SetPointGridEnabled(bool bEnabled)
 {
-    OutPointIndices.Reset();
-
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
+    bUsePointGrid = bEnabled;
+    UpdatePointGrid();
+    UpdateStats();
+}
 
-    if (! IsValidDelaunatorObject()             ||
-        ! InPoints.IsValidIndex(BoundaryPoint0) ||
-        ! InPoints.IsValidIndex(BoundaryPoint1) ||
-        BoundaryPoint0 == BoundaryPoint1        ||
-        InBoundaryTriangles.Num() < 1)
+void UDelaunatorObject::UpdatePointGrid()
+{
+    if (! bUsePointGrid || ! IsValidDelaunatorObject())
     {
-        return false;
+        PointGrid.Empty();
+        return;
     }
 
-    // Single boundary triangle, check if both boundary point is in the triangle
-    if (InBoundaryTriangles.Num() == 1)
-    {
-        int32 ti = InBoundaryTriangles[0];
-        int32 pi0 = FindCornerIndex(ti, BoundaryPoint0);
-        int32 pi1 = FindCornerIndex(ti, BoundaryPoint1);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdatePointGrid);
 
-        // Both boundary points is in triangle, add as output indices then return
-        if (pi0 >=0 && pi1 >= 0)
-        {
-            int32 iNext = GetNextTriCorner(ti, pi0);
-            int32 iPrev = GetPrevTriCorner(ti, pi0);
-            int32 iMid = iNext == pi1 ? iPrev : iNext;
+    const TArray<FVector2D>& InPoints(GetPoints());
+    const int32 PointCount = InPoints.Num();
 
-            OutPointIndices.Emplace(BoundaryPoint0);
-            OutPointIndices.Emplace(InTriangles[iMid]);
-            OutPointIndices.Emplace(BoundaryPoint1);
+    FBox2D Bounds(ForceInit);
 
-            return true;
-        }
-        // Triangle does not contain both boundary points, abort
-        else
+    for (int32 i=0; i<PointCount; ++i)
+    {
+        if (Inedges[i] >= 0)
         {
-            return false;
+            Bounds += InPoints[i];
         }
     }
 
-    const FVector2D& BP0(InPoints[BoundaryPoint0]);
-    const FVector2D& BP1(InPoints[BoundaryPoint1]);
-    const FVector2D DBP01 = BP1-BP0;
-    const FVector2D CBP01(-DBP01.Y, DBP01.X);
+    // About two points per cell, degenerate bounds fall back to a cell row
 
-    TArray<int32> PointIndices;
+    const FVector2D Extent(Bounds.GetSize());
+    const float LineCellSize = Extent.GetMax() * 2.f / PointCount;
+    const float Area = FMath::Max(Extent.X*Extent.Y, LineCellSize*LineCellSize);
+    const float CellSize = FMath::Max(FMath::Sqrt(Area * 2.f / PointCount), KINDA_SMALL_NUMBER);
 
-    int32 It = BoundaryPoint0;
-    int32 ti = InBoundaryTriangles[0];
-    int32 pi = FindCornerIndex(ti, It);
+    const int32 DimX = FMath::Clamp(FMath::CeilToInt(Extent.X / CellSize), 1, PointCount);
+    const int32 DimY = FMath::Clamp(FMath::CeilToInt(Extent.Y / CellSize), 1, PointCount);
 
-    if (pi < 0)
-    {
-        return false;
-    }
+    PointGridOrigin = Bounds.Min;
+    PointGridScale.Set(DimX / FMath::Max(Extent.X, KINDA_SMALL_NUMBER), DimY / FMath::Max(Extent.Y, KINDA_SMALL_NUMBER));
+    PointGridDimension = FIntPoint(DimX, DimY);
 
-    PointIndices.Emplace(It);
+    PointGrid.Init(-1, DimX*DimY);
 
-    for (int32 i=0; i<(InBoundaryTriangles.Num()-1); ++i)
+    for (int32 i=0; i<PointCount; ++i)
     {
-        ti = InBoundaryTriangles[i];
-        pi = FindCornerIndex(ti, It);
-
-        if (pi < 0)
+        if (Inedges[i] >= 0)
         {
-            return false;
+            int32& Cell(PointGrid[FindPointGridCell(InPoints[i])]);
+
+            if (Cell < 0)
+            {
+                Cell = i;
+            }
         }
+    }
 
-        int32 iNext = GetNextTriCorner(ti, pi);
-        int32 iPrev = GetPrevTriCorner(ti, pi);
+    // Fill empty cells from filled cells along the row,
+    // then fill empty rows from the nearest filled row
 
-        const FVector2D& PNext(InPoints[InTriangles[iNext]]);
-        const FVector2D& PPrev(InPoints[InTriangles[iPrev]]);
+    int32 LastFilledRow = -1;
 
-        const float DotNext = (PNext-BP0) | CBP01;
-        const float DotPrev = (PPrev-BP0) | CBP01;
+    for (int32 y=0; y<DimY; ++y)
+    {
+        int32* Row = PointGrid.GetData() + y*DimX;
+        int32 Last = -1;
 
-        if (DotNext >= 0.f && DotPrev >= 0.f)
+        for (int32 x=0; x<DimX; ++x)
         {
-            if (DotNext > DotPrev)
-            {
-                It = InTriangles[iNext];
-            }
-            else
-            {
-                It = InTriangles[iPrev];
-            }
+            Row[x] = (Row[x] < 0) ? Last : Row[x];
+            Last = Row[x];
         }
-        else
-        if (DotNext >= 0.f)
+
+        Last = -1;
+
+        for (int32 x=DimX-1; x>=0; --x)
         {
-            It = InTriangles[iNext];
+            Row[x] = (Row[x] < 0) ? Last : Row[x];
+            Last = Row[x];
         }
-        else
-        if (DotPrev >= 0.f)
+
+        if (Row[0] < 0)
         {
-            It = InTriangles[iPrev];
+            continue;
         }
 
-        if (PointIndices.Num() == 0 || PointIndices.Last() != It)
+        // Rows between filled rows take the closer one
+        for (int32 ey=LastFilledRow+1; ey<y; ++ey)
         {
-            PointIndices.Emplace(It);
+            const int32 SourceRow = (LastFilledRow >= 0 && ey-LastFilledRow <= y-ey) ? LastFilledRow : y;
+            FMemory::Memcpy(PointGrid.GetData() + ey*DimX, PointGrid.GetData() + SourceRow*DimX, DimX*sizeof(int32));
         }
-    }
 
-    It = BoundaryPoint1;
+        LastFilledRow = y;
+    }
 
-    // Check if last triangle have BoundaryPoint1
-    if (FindCornerIndex(InBoundaryTriangles.Last(), It) >= 0)
+    for (int32 ey=LastFilledRow+1; ey<DimY; ++ey)
     {
-        PointIndices.Emplace(BoundaryPoint1);
-        OutPointIndices = MoveTemp(PointIndices);
+        FMemory::Memcpy(PointGrid.GetData() + ey*DimX, PointGrid.GetData() + LastFilledRow*DimX, DimX*sizeof(int32));
+    }
+}
 
-        return true;
+void UDelaunatorObject::UpdatePointGridCell(int32 PointIndex)
+{
+    const int32 CellIndex = FindPointGridCell(GetPoints()[PointIndex]);
+    const int32 CellPoint = PointGrid[CellIndex];
+
+    // Replace removed points and points filled in from other cells
+    if (! IsTriangulatedPoint(CellPoint) || FindPointGridCell(GetPoints()[CellPoint]) != CellIndex)
+    {
+        PointGrid[CellIndex] = PointIndex;
     }
+}
 
-    return false;
+void UDelaunatorObject::SetNeighbourCacheEnabled(bool bEnabled)
+{
+    bUseNeighbourCache = bEnabled;
+    UpdateNeighbourCache();
+    UpdateStats();
 }
 
-bool UDelaunatorObject::FindPolyBoundaryTriangles(
-    TArray<int32>& OutTriangles,
-    const TArray<int32>& InPolyPointIndices,
-    bool bClosedPoly,
-    bool bAllowDirectConnection
-    )
+void UDelaunatorObject::RebuildNeighbourCache()
 {
-    OutTriangles.Reset();
+    UpdateNeighbourCache();
+    UpdateStats();
+}
 
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
+void UDelaunatorObject::InvalidateNeighbourCache()
+{
+    // Keep the allocation for the next rebuild
+    NeighbourOffsets.Reset();
+    NeighbourIndices.Reset();
+}
 
-    if (! IsValidDelaunatorObject()                     ||
-        (! bClosedPoly && InPolyPointIndices.Num() < 2) ||
-        (  bClosedPoly && InPolyPointIndices.Num() < 3))
+void UDelaunatorObject::UpdateNeighbourCache()
+{
+    if (! bUseNeighbourCache || ! IsValidDelaunatorObject())
     {
-        return false;
+        NeighbourOffsets.Empty();
+        NeighbourIndices.Empty();
+        return;
     }
 
-    check(InPoints.IsValidIndex(InPolyPointIndices[0]));
-    check(InPoints.IsValidIndex(InPolyPointIndices.Last()));
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::UpdateNeighbourCache);
 
-    const FVector2D& P0(InPoints[InPolyPointIndices[0]]);
-    const FVector2D& PN(InPoints[InPolyPointIndices.Last()]);
+    const TArray<int32>& InTriangles(GetTriangles());
+    const TArray<int32>& InHalfEdges(GetHalfEdges());
 
-    TArray<int32> BoundaryTriangles;
+    const int32 PointCount = GetPoints().Num();
 
-    const int32 PolyPointCount = InPolyPointIndices.Num();
-    const int32 PointItCount = (! bClosedPoly || P0.Equals(PN))
-        ? PolyPointCount-1
-        : PolyPointCount;
+    // Work items per parallel chunk
+    const int32 ChunkSize = 1 << 14;
+    const int32 ChunkCount = FMath::DivideAndRoundUp(PointCount, ChunkSize);
 
-    // Find all triangles between boundary poly
-    for (int32 i=0; i<PointItCount; ++i)
+    // Walk point triangles in the same order as GetPointNeighbours()
+    auto VisitNeighbours = [&](int32 PointIndex, auto&& Visit)
     {
-        int32 i0 = i;
-        int32 i1 = i+1;
+        const int32 e0 = Inedges[PointIndex];
 
-        if (i1 == PolyPointCount)
+        if (e0 == -1)
         {
-            i1 = 0;
+            return;
         }
 
-        int32 pi0 = InPolyPointIndices[i0];
-        int32 pi1 = InPolyPointIndices[i1];
-
-        // Invalid input points, abort
-        if (! InPoints.IsValidIndex(pi0) ||
-            ! InPoints.IsValidIndex(pi1))
+        int32 e = e0;
+        do
         {
-            return false;
+            Visit(InTriangles[e]);
+            e = ((e%3) == 2) ? e-2 : e+1;
+            e = InHalfEdges[e];
         }
+        while (e != e0 && e != -1);
+    };
 
-        // Find triangles between polyline
+    // Count neighbours, prefix sum counts into offsets then fill neighbours
 
-        TArray<int32> TrianglesBetweenPoints;
+    NeighbourOffsets.SetNumUninitialized(PointCount+1, false);
+    NeighbourOffsets[0] = 0;
 
-        FindTrianglesBetweenPoints(
-            TrianglesBetweenPoints,
-            pi0,
-            pi1
-            );
+    ParallelFor(ChunkCount, [&](int32 ChunkIndex)
+    {
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min(Start+ChunkSize, PointCount);
 
-        // Poly line have direct connection within single triangle, skip
-        if (!bAllowDirectConnection && TrianglesBetweenPoints.Num() == 1)
+        for (int32 i=Start; i<End; ++i)
         {
-            continue;
+            int32 Count = 0;
+            VisitNeighbours(i, [&Count](int32) { ++Count; });
+            NeighbourOffsets[i+1] = Count;
         }
+    } );
 
-        // Add triangle between points as boundary triangles
-        BoundaryTriangles.Append(TrianglesBetweenPoints);
+    for (int32 i=0; i<PointCount; ++i)
+    {
+        NeighbourOffsets[i+1] += NeighbourOffsets[i];
     }
 
-    // Find all boundary triangles out of poly
-    {
-        TArray<FVector2D> PolyPoints;
-        TSet<int32> BoundarySet(InPolyPointIndices);
+    NeighbourIndices.SetNumUninitialized(NeighbourOffsets[PointCount], false);
 
-        PolyPoints.SetNumUninitialized(InPolyPointIndices.Num());
+    ParallelFor(ChunkCount, [&](int32 ChunkIndex)
+    {
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min(Start+ChunkSize, PointCount);
 
-        for (int32 i=0; i<InPolyPointIndices.Num(); ++i)
+        for (int32 i=Start; i<End; ++i)
         {
-            PolyPoints[i] = InPoints[InPolyPointIndices[i]];
+            int32* Neighbours = NeighbourIndices.GetData() + NeighbourOffsets[i];
+            VisitNeighbours(i, [&Neighbours](int32 n) { *Neighbours++ = n; });
         }
+    } );
+}
 
-        const int32 TriangleCount = GetTriangleCount();
-
-        for (int32 ti=0; ti<TriangleCount; ++ti)
-        {
-            int32 i = ti*3;
-            int32 pi0 = InTriangles[i  ];
-            int32 pi1 = InTriangles[i+1];
-            int32 pi2 = InTriangles[i+2];
-
-            // Triangle consists of boundary points
-            if (BoundarySet.Contains(pi0) &&
-                BoundarySet.Contains(pi1) &&
-                BoundarySet.Contains(pi2))
-            {
-                FVector2D TriCenter =
-                    (InPoints[pi0] + InPoints[pi1] + InPoints[pi2]) / 3.f;
+int32 UDelaunatorObject::FindPoint(const FVector2D& TargetPoint, int32 InitialPoint) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPoint);
 
-                // Triangle center is outside of poly, mark as boundary triangle
-                if (! UGULPolyUtilityLibrary::IsPointOnPoly(TriCenter, PolyPoints))
-                {
-                    BoundaryTriangles.Emplace(ti);
-                }
-            }
-        }
+    if (! IsValidDelaunatorObject())
+    {
+        return -1;
     }
 
-    OutTriangles = TSet<int32>(BoundaryTriangles).Array();
+    uint32 IterationCount = 0;
+    const int32 Result = WalkToPoint(TargetPoint, InitialPoint, IterationCount);
 
-    return true;
+    INC_DWORD_STAT_BY(STAT_DelaunatorFindCloserIterations, IterationCount);
+
+    return Result;
 }
 
-bool UDelaunatorObject::FindPolyGroupsBoundaryTriangles(
-    TArray<int32>& OutTriangles,
-    const TArray<FGULIntGroup>& InPolyBoundaryGroups,
-    bool bClosedPoly,
-    bool bAllowDirectConnection
-    )
+void UDelaunatorObject::FindPoints(TArrayView<const FVector2D> InTargetPoints, TArrayView<int32> OutPointIndices) const
 {
-    OutTriangles.Reset();
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::FindPoints);
 
-    const TArray<FVector2D>& InPoints(GetPoints());
-    const TArray<int32>& InTriangles(GetTriangles());
+    check(InTargetPoints.Num() == OutPointIndices.Num());
 
-    if (! IsValidDelaunatorObject()   ||
-        InPolyBoundaryGroups.Num() < 1)
+    const int32 QueryCount = InTargetPoints.Num();
+
+    if (! IsValidDelaunatorObject())
     {
-        return false;
-    }
+        for (int32& PointIndex : OutPointIndices)
+        {
+            PointIndex = -1;
+        }
 
-    TArray<int32> BoundaryTriangles;
+        return;
+    }
 
-    for (const FGULIntGroup& PolyBoundaryGroup : InPolyBoundaryGroups)
+    if (QueryCount < 1)
     {
-        const TArray<int32>& PolyIndices(PolyBoundaryGroup.Values);
+        return;
+    }
 
-        if ((! bClosedPoly && PolyIndices.Num() < 2) ||
-            (  bClosedPoly && PolyIndices.Num() < 3))
-        {
-            continue;
-        }
+    // Visit queries along a hilbert curve and start each walk
+    // from the result of the previous query in the chunk
 
-        check(InPoints.IsValidIndex(PolyIndices[0]));
-        check(InPoints.IsValidIndex(PolyIndices.Last()));
+    TArray<int32> QueryOrder;
+    delaunator::hilbert_order(MakeArrayView(&InTargetPoints.GetData()->X, QueryCount*2), QueryOrder);
 
-        const FVector2D& P0(InPoints[PolyIndices[0]]);
-        const FVector2D& PN(InPoints[PolyIndices.Last()]);
+    // Queries per parallel chunk
+    const int32 ChunkSize = 1 << 12;
 
-        const int32 PolyPointCount = PolyIndices.Num();
-        const int32 PointItCount = (! bClosedPoly || P0.Equals(PN))
-            ? PolyPointCount-1
-            : PolyPointCount;
+    ParallelFor(FMath::DivideAndRoundUp(QueryCount, ChunkSize), [&](int32 ChunkIndex)
+    {
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min(Start+ChunkSize, QueryCount);
 
-        for (int32 i=0; i<PointItCount; ++i)
+        uint32 IterationCount = 0;
+        int32 HintPoint = -1;
+
+        for (int32 i=Start; i<End; ++i)
         {
-            int32 i0 = i;
-            int32 i1 = i+1;
+            const int32 QueryIndex = QueryOrder[i];
+            const FVector2D& TargetPoint(InTargetPoints[QueryIndex]);
 
-            if (i1 == PolyPointCount)
+            // Sparse queries may be closer to their point grid cell
+            if (PointGrid.Num() > 0 && HintPoint >= 0)
             {
-                i1 = 0;
-            }
+                const int32 GridPoint = PointGrid[FindPointGridCell(TargetPoint)];
 
-            int32 pi0 = PolyIndices[i0];
-            int32 pi1 = PolyIndices[i1];
-
-            // Invalid input points, abort
-            if (! InPoints.IsValidIndex(pi0) ||
-                ! InPoints.IsValidIndex(pi1))
-            {
-                return false;
+                if (IsTriangulatedPoint(GridPoint) &&
+                    (TargetPoint-GetPoints()[GridPoint]).SizeSquared() < (TargetPoint-GetPoints()[HintPoint]).SizeSquared())
+                {
+                    HintPoint = GridPoint;
+                }
             }
 
-            // Find triangles between polyline
-
-            TArray<int32> TrianglesBetweenPoints;
+            HintPoint = WalkToPoint(TargetPoint, HintPoint, IterationCount);
+            OutPointIndices[QueryIndex] = HintPoint;
+        }
 
-            FindTrianglesBetweenPoints(
-                TrianglesBetweenPoints,
-                pi0,
-                pi1
-                );
+        INC_DWORD_STAT_BY(STAT_DelaunatorFindCloserIterations, IterationCount);
+    } );
+}
 
-            // Poly line have direct connection within single triangle, skip
-            if (!bAllowDirectConnection && TrianglesBetweenPoints.Num() == 1)
-            {
-                continue;
-            }
+int32 UDelaunatorObject::WalkToPoint(const FVector2D& TargetPoint, int32 InitialPoint, uint32& InOutIterationCount) const
+{
+    // No valid or triangulated initial point specified, start from the
+    // point grid cell or default to center point
+    if (! IsTriangulatedPoint(InitialPoint))
+    {
+        InitialPoint = (PointGrid.Num() > 0) ? PointGrid[FindPointGridCell(TargetPoint)] : -1;
 
-            // Add triangle between points as boundary triangles
-            BoundaryTriangles.Append(TrianglesBetweenPoints);
+        if (! IsTriangulatedPoint(InitialPoint))
+        {
+            InitialPoint = GetTriangles()[0];
         }
     }
 
-    // Remove all triangles out of poly
-
-    TArray<FGULVector2DGroup> BoundaryPolyGroups;
-    TSet<int32> BoundarySet;
-
-    // Gather poly boundary points and index set
-    for (const FGULIntGroup& PolyBoundaryGroup : InPolyBoundaryGroups)
+    // Initial point coincident with target point, return initial point
+    if (TargetPoint.Equals(GetPoints()[InitialPoint]))
     {
-        const TArray<int32>& PolyIndices(PolyBoundaryGroup.Values);
-        const int32 PointCount = PolyIndices.Num();
+        return InitialPoint;
+    }
 
-        BoundaryPolyGroups.AddDefaulted();
-        
-        TArray<FVector2D>& BoundaryPoints(BoundaryPolyGroups.Last().Points);
-        BoundaryPoints.SetNumUninitialized(PointCount);
+    // Find all cell closer to target point
 
-        for (int32 i=0; i<PointCount; ++i)
-        {
-            BoundaryPoints[i] = InPoints[PolyIndices[i]];
-        }
+    int32 i = InitialPoint;
+    int32 c;
 
-        BoundarySet.Append(PolyIndices);
+    ++InOutIterationCount;
+
+    while ((c = FindCloser(i, TargetPoint)) >= 0 && c != i && c != InitialPoint)
+    {
+        i = c;
+        ++InOutIterationCount;
     }
 
-    // Find all boundary triangles out of poly
+    return c;
+}
 
-    const int32 TriangleCount = GetTriangleCount();
+bool UDelaunatorObject::WalkToTriangle(const FVector2D& TargetPoint, int32 HintTriangle, int32& OutTriangle, FVector& OutWeights) const
+{
+    // Valid hint is used as is unless the point grid may offer a closer start
+    const int32 StartTriangle = (HintTriangle >= 0 && HintTriangle < GetTriangleCount() && PointGrid.Num() == 0)
+        ? HintTriangle
+        : FindWalkStartTriangle(TargetPoint, HintTriangle);
 
-    for (int32 ti=0; ti<TriangleCount; ++ti)
+    bool bOutside;
+    const int32 e = Delaunator.locate(TargetPoint.X, TargetPoint.Y, StartTriangle, bOutside);
+
+    OutTriangle = e / 3;
+
+    if (bOutside)
     {
-        int32 i = ti*3;
-        int32 pi0 = InTriangles[i  ];
-        int32 pi1 = InTriangles[i+1];
-        int32 pi2 = InTriangles[i+2];
+        OutWeights = FVector::ZeroVector;
+        return false;
+    }
 
-        // Triangle consists of boundary points
-        if (BoundarySet.Contains(pi0) &&
-            BoundarySet.Contains(pi1) &&
-            BoundarySet.Contains(pi2))
-        {
-            FVector2D TriCenter =
-                (InPoints[pi0] + InPoints[pi1] + InPoints[pi2]) / 3.f;
+    const TArray<int32>& Triangles(GetTriangles());
+    const FVector2D& A(GetPoints()[Triangles[e]]);
+    const FVector2D& B(GetPoints()[Triangles[e+1]]);
+    const FVector2D& C(GetPoints()[Triangles[e+2]]);
 
-            for (const FGULVector2DGroup& PolyGroup : BoundaryPolyGroups)
-            {
-                bool bPointOnPoly = UGULPolyUtilityLibrary::IsPointOnPoly(
-                    TriCenter,
-                    PolyGroup.Points
-                    );
+    const float Det = (B.Y-C.Y)*(A.X-C.X) + (C.X-B.X)*(A.Y-C.Y);
 
-                // Triangle center is outside of poly,
-                // mark as boundary triangle
-                if (! bPointOnPoly)
-                {
-                    BoundaryTriangles.Emplace(ti);
-                    break;
-                }
-            }
-        }
+    // Degenerate triangle, snap to the first corner
+    if (Det == 0.f)
+    {
+        OutWeights.Set(1.f, 0.f, 0.f);
+        return true;
     }
 
-    OutTriangles = TSet<int32>(BoundaryTriangles).Array();
+    OutWeights.X = ((B.Y-C.Y)*(TargetPoint.X-C.X) + (C.X-B.X)*(TargetPoint.Y-C.Y)) / Det;
+    OutWeights.Y = ((C.Y-A.Y)*(TargetPoint.X-C.X) + (A.X-C.X)*(TargetPoint.Y-C.Y)) / Det;
+    OutWeights.Z = 1.f - OutWeights.X - OutWeights.Y;
 
     return true;
 }
 
-UDelaunatorVoronoi* UDelaunatorObject::GenerateVoronoiDual()
+int32 UDelaunatorObject::LocateTriangle(const FVector2D& TargetPoint, FVector& OutWeights, int32 HintTriangle) const
 {
-    UDelaunatorVoronoi* Voronoi = NewObject<UDelaunatorVoronoi>(this);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::LocateTriangle);
 
-    if (IsValid(Voronoi))
+    OutWeights = FVector::ZeroVector;
+
+    if (! IsValidDelaunatorObject())
     {
-        Voronoi->GenerateFrom(this);
+        return -1;
     }
 
-    return Voronoi;
+    int32 Triangle;
+    return WalkToTriangle(TargetPoint, HintTriangle, Triangle, OutWeights) ? Triangle : -1;
 }
 
-int32 UDelaunatorObject::FindPoint(const FVector2D& TargetPoint, int32 InitialPoint) const
+void UDelaunatorObject::InterpolateValues(
+    const UDelaunatorValueObject* ValueObject,
+    TArrayView<const FVector2D> InPositions,
+    TArrayView<float> OutValues
+    ) const
 {
-    if (! IsValidDelaunatorObject())
-    {
-        return -1;
-    }
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorObject::InterpolateValues);
 
-    // No valid initial point specified, default to center point
-    if (! Points.IsValidIndex(InitialPoint))
+    check(InPositions.Num() == OutValues.Num());
+
+    const int32 QueryCount = InPositions.Num();
+
+    if (! IsValidDelaunatorObject() ||
+        ! IsValid(ValueObject) ||
+        ! ValueObject->IsValidElementCount(GetPointCount()))
     {
-        InitialPoint = GetTriangles()[0];
+        for (float& Value : OutValues)
+        {
+            Value = 0.f;
+        }
+
+        return;
     }
 
-    // Initial point coincident with target point, return initial point
-    if (TargetPoint.Equals(Points[InitialPoint]))
+    if (QueryCount < 1)
     {
-        return InitialPoint;
+        return;
     }
 
-    // Find all cell closer to target point
+    // Visit queries along a hilbert curve and start each walk
+    // from the triangle of the previous query in the chunk
 
-    int32 i = InitialPoint;
-    int32 c;
+    TArray<int32> QueryOrder;
+    delaunator::hilbert_order(MakeArrayView(&InPositions.GetData()->X, QueryCount*2), QueryOrder);
 
-    while ((c = FindCloser(i, TargetPoint)) >= 0 && c != i && c != InitialPoint)
+    const TArray<int32>& Triangles(GetTriangles());
+
+    // Queries per parallel chunk
+    const int32 ChunkSize = 1 << 12;
+
+    ParallelFor(FMath::DivideAndRoundUp(QueryCount, ChunkSize), [&](int32 ChunkIndex)
     {
-        i = c;
-    }
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min(Start+ChunkSize, QueryCount);
 
-    return c;
+        uint32 IterationCount = 0;
+        int32 HintTriangle = -1;
+
+        for (int32 i=Start; i<End; ++i)
+        {
+            const int32 QueryIndex = QueryOrder[i];
+            const FVector2D& Position(InPositions[QueryIndex]);
+
+            FVector Weights;
+
+            if (WalkToTriangle(Position, HintTriangle, HintTriangle, Weights))
+            {
+                const int32 t = HintTriangle*3;
+
+                OutValues[QueryIndex] =
+                    ValueObject->GetValueFloat(Triangles[t  ]) * Weights.X +
+                    ValueObject->GetValueFloat(Triangles[t+1]) * Weights.Y +
+                    ValueObject->GetValueFloat(Triangles[t+2]) * Weights.Z;
+            }
+            // Outside the hull, take the value of the closest point
+            else
+            {
+                const int32 ClosestPoint = WalkToPoint(Position, Triangles[HintTriangle*3], IterationCount);
+                OutValues[QueryIndex] = ValueObject->GetValueFloat(ClosestPoint);
+            }
+        }
+
+        INC_DWORD_STAT_BY(STAT_DelaunatorFindCloserIterations, IterationCount);
+    } );
 }
 
 int32 UDelaunatorObject::FindCloser(int32 i, const FVector2D& TargetPoint) const
@@ -1110,20 +2531,21 @@ int32 UDelaunatorObject::FindCloser(int32 i, const FVector2D& TargetPoint) const
 
     check(IsValidDelaunatorObject());
 
-    if (Inedges[i] == -1)
+    // Point not in triangulation, no neighbours to walk to
+    if (! IsTriangulatedPoint(i))
     {
-        return (i+1) % (Points.Num() >> 1);
+        return -1;
     }
 
     const int32 e0 = Inedges[i];
     int32 e = e0;
     int32 c = i;
-    float dc = (TargetPoint-Points[i]).SizeSquared();
+    float dc = (TargetPoint-GetPoints()[i]).SizeSquared();
 
     do
     {
         int32 t = Triangles[e];
-        const float dt = (TargetPoint-Points[t]).SizeSquared();
+        const float dt = (TargetPoint-GetPoints()[t]).SizeSquared();
 
         if (dt < dc)
         {
@@ -1145,7 +2567,7 @@ int32 UDelaunatorObject::FindCloser(int32 i, const FVector2D& TargetPoint) const
 
             if (e != t)
             {
-                const float dh = (TargetPoint-Points[e]).SizeSquared();
+                const float dh = (TargetPoint-GetPoints()[e]).SizeSquared();
 
                 if (dh < dc)
                 {
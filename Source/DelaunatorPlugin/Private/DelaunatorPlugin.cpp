@@ -47,4 +47,11 @@ void FDelaunatorPlugin::ShutdownModule()
 IMPLEMENT_MODULE(FDelaunatorPlugin, DelaunatorPlugin)
 DEFINE_LOG_CATEGORY(LogDel);
 
+DEFINE_STAT(STAT_DelaunatorLegalizeFlips);
+DEFINE_STAT(STAT_DelaunatorHullHashProbes);
+DEFINE_STAT(STAT_DelaunatorHullWalkSteps);
+DEFINE_STAT(STAT_DelaunatorFindCloserIterations);
+DEFINE_STAT(STAT_DelaunatorVisitedNodes);
+DEFINE_STAT(STAT_DelaunatorAllocatedMemory);
+
 #undef LOCTEXT_NAMESPACE
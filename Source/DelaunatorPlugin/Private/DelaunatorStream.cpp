@@ -0,0 +1,695 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+
+#include "DelaunatorStream.h"
+#include "DelaunatorPlugin.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
+#include "Algo/BinarySearch.h"
+#include "delaunator/delaunator.hpp"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+
+FORCEINLINE uint64 GetStreamEdgeKey(int32 a, int32 b)
+{
+    return (static_cast<uint64>(static_cast<uint32>(a)) << 32) | static_cast<uint32>(b);
+}
+
+FORCEINLINE int32 GetStreamNextEdge(int32 e)
+{
+    return ((e%3) == 2) ? e-2 : e+1;
+}
+
+FORCEINLINE int64 GetStreamTriangleOffset(int64 TriangleIndex)
+{
+    return sizeof(FDelaunatorStreamHeader) + TriangleIndex * sizeof(FDelaunatorStreamTriangle);
+}
+
+// Index of a global point in the active set, active points stay sorted
+FORCEINLINE int32 FindActivePoint(const TArray<int32>& ActiveIndices, int32 PointIndex)
+{
+    const int32 i = Algo::LowerBound(ActiveIndices, PointIndex);
+    return (i < ActiveIndices.Num() && ActiveIndices[i] == PointIndex) ? i : -1;
+}
+
+}
+
+bool FDelaunatorStreamTriangulator::WritePointFile(const FString& Filename, TArray<FVector2D>& InOutPoints)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunatorStreamTriangulator::WritePointFile);
+
+    InOutPoints.Sort([](const FVector2D& A, const FVector2D& B) { return A.X < B.X; });
+
+    TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Filename));
+
+    return File.IsValid()
+        && File->Write(reinterpret_cast<const uint8*>(InOutPoints.GetData()), InOutPoints.Num()*sizeof(FVector2D));
+}
+
+bool FDelaunatorStreamTriangulator::Triangulate(
+    const FString& PointFile,
+    const FString& MeshFile,
+    int32 ChunkPointCount,
+    int32 PageTriangleCount,
+    bool bRobustPredicates
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunatorStreamTriangulator::Triangulate);
+
+    IPlatformFile& PlatformFile(FPlatformFileManager::Get().GetPlatformFile());
+
+    TUniquePtr<IMappedFileHandle> PointHandle(PlatformFile.OpenMapped(*PointFile));
+
+    if (! PointHandle.IsValid())
+    {
+        UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Unable to map point file %s"), *PointFile);
+        return false;
+    }
+
+    const int64 PointCount = PointHandle->GetFileSize() / sizeof(FVector2D);
+
+    if (PointCount < 3 || PointCount > MaxPointCount || ChunkPointCount < 3 || PageTriangleCount < 1)
+    {
+        UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Invalid point or chunk count"));
+        return false;
+    }
+
+    TUniquePtr<IFileHandle> MeshHandle(PlatformFile.OpenWrite(*MeshFile));
+
+    if (! MeshHandle.IsValid())
+    {
+        UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Unable to open mesh file %s"), *MeshFile);
+        return false;
+    }
+
+    // Write at an absolute mesh file offset, logs a failed seek or write
+    auto WriteMesh = [&MeshHandle, &MeshFile](int64 Offset, const void* Data, int64 Size)
+    {
+        if (MeshHandle->Seek(Offset) && MeshHandle->Write(reinterpret_cast<const uint8*>(Data), Size))
+        {
+            return true;
+        }
+
+        UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Unable to write mesh file %s"), *MeshFile);
+        return false;
+    };
+
+    FDelaunatorStreamHeader Header;
+    Header.Magic = FileMagic;
+    Header.Version = FileVersion;
+    Header.PointCount = PointCount;
+    Header.TriangleCount = 0;
+    Header.PageTableOffset = 0;
+    Header.PageTriangleCount = PageTriangleCount;
+    Header.PageCount = 0;
+
+    // Header is rewritten once the triangle count is known
+    if (! WriteMesh(0, &Header, sizeof(Header)))
+    {
+        return false;
+    }
+
+    delaunator::Delaunator Delaunator;
+    Delaunator.retain_capacity = true;
+    Delaunator.robust_predicates = bRobustPredicates;
+
+    // Sweep front, points of unwritten triangles, hull points and
+    // points of written boundary edges, sorted by global index
+    TArray<int32> ActiveIndices;
+    TArray<float> ActiveCoords;
+
+    // Directed edges of written triangles whose twin is not written yet,
+    // mapped to the global halfedge to link once the twin is written
+    TMap<uint64, int32> Boundary;
+
+    // Per local triangle, -2 inside the written region, -1 unwritten
+    // or the global index of a triangle written this chunk
+    TArray<int32> TriangleStates;
+    TArray<int32> Inedges;
+    TArray<int32> FloodStack;
+    TBitArray<> KeepFlags;
+
+    TArray<FDelaunatorStreamTriangle> WrittenTriangles;
+    TArray<int32> WrittenLocalTriangles;
+    TArray<TPair<int32, int32>> HalfEdgePatches;
+    TArray<FDelaunatorStreamPage> Pages;
+
+    int64 TriangleCount = 0;
+    float LastX = -BIG_NUMBER;
+
+    for (int64 ChunkStart=0; ChunkStart<PointCount; ChunkStart+=ChunkPointCount)
+    {
+        const int64 ChunkEnd = FMath::Min<int64>(ChunkStart+ChunkPointCount, PointCount);
+        const bool bLastChunk = ChunkEnd == PointCount;
+
+        // Map the chunk and the next point, the sweep position
+
+        const int64 MapCount = ChunkEnd - ChunkStart + (bLastChunk ? 0 : 1);
+
+        TUniquePtr<IMappedFileRegion> ChunkRegion(PointHandle->MapRegion(
+            ChunkStart * sizeof(FVector2D),
+            MapCount * sizeof(FVector2D)
+            ) );
+
+        if (! ChunkRegion.IsValid())
+        {
+            UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Unable to map point chunk"));
+            return false;
+        }
+
+        const FVector2D* ChunkPoints = reinterpret_cast<const FVector2D*>(ChunkRegion->GetMappedPtr());
+
+        for (int64 i=0; i<ChunkEnd-ChunkStart; ++i)
+        {
+            const FVector2D& Point(ChunkPoints[i]);
+
+            if (Point.X < LastX)
+            {
+                UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Points are not sorted along X"));
+                return false;
+            }
+
+            LastX = Point.X;
+
+            ActiveIndices.Emplace(static_cast<int32>(ChunkStart + i));
+            ActiveCoords.Emplace(Point.X);
+            ActiveCoords.Emplace(Point.Y);
+        }
+
+        const float SweepX = bLastChunk ? BIG_NUMBER : ChunkPoints[MapCount-1].X;
+
+        ChunkRegion.Reset();
+
+        Delaunator.coords = MakeArrayView(ActiveCoords);
+        Delaunator.update();
+
+        const TArray<int32>& Triangles(Delaunator.triangles);
+        const TArray<int32>& HalfEdges(Delaunator.halfedges);
+        const int32 ActiveCount = ActiveIndices.Num();
+
+        // Collinear so far, carry all points to the next chunk
+        if (Triangles.Num() < 3)
+        {
+            continue;
+        }
+
+        // Restore written boundary edges, the active set may
+        // triangulate cocircular points with another diagonal
+
+        Inedges.Init(-1, ActiveCount);
+
+        for (int32 e=0; e<Triangles.Num(); ++e)
+        {
+            Inedges[Triangles[GetStreamNextEdge(e)]] = e;
+        }
+
+        for (const TPair<uint64, int32>& Edge : Boundary)
+        {
+            const int32 a = FindActivePoint(ActiveIndices, static_cast<int32>(Edge.Key >> 32));
+            const int32 b = FindActivePoint(ActiveIndices, static_cast<int32>(Edge.Key & 0xFFFFFFFF));
+
+            // Unrestored boundary would let the flood below leak into
+            // the front and drop its triangles from the output
+            if (a < 0 || b < 0 || Inedges[a] < 0 || ! Delaunator.constrain(a, Inedges[a], b))
+            {
+                UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamTriangulator::Triangulate() - Unable to restore written boundary edge"));
+                return false;
+            }
+
+            for (int32 t : Delaunator.touched)
+            {
+                for (int32 e=t*3; e<t*3+3; ++e)
+                {
+                    Inedges[Triangles[GetStreamNextEdge(e)]] = e;
+                }
+            }
+        }
+
+        auto GetEdgeKey = [&](int32 e)
+        {
+            return GetStreamEdgeKey(ActiveIndices[Triangles[e]], ActiveIndices[Triangles[GetStreamNextEdge(e)]]);
+        };
+
+        auto GetTwinKey = [&](int32 e)
+        {
+            return GetStreamEdgeKey(ActiveIndices[Triangles[GetStreamNextEdge(e)]], ActiveIndices[Triangles[e]]);
+        };
+
+        // Flood the written region from its boundary edges, the active
+        // set covers it again with triangles that must not be written
+
+        const int32 LocalTriangleCount = Triangles.Num() / 3;
+
+        TriangleStates.Init(-1, LocalTriangleCount);
+        FloodStack.Reset();
+
+        if (Boundary.Num() > 0)
+        {
+            for (int32 e=0; e<Triangles.Num(); ++e)
+            {
+                if (TriangleStates[e/3] == -1 && Boundary.Contains(GetEdgeKey(e)))
+                {
+                    TriangleStates[e/3] = -2;
+                    FloodStack.Emplace(e/3);
+                }
+            }
+        }
+
+        while (FloodStack.Num() > 0)
+        {
+            const int32 t = FloodStack.Pop(false);
+
+            for (int32 e=t*3; e<t*3+3; ++e)
+            {
+                const int32 o = HalfEdges[e];
+
+                if (o >= 0 && TriangleStates[o/3] == -1 && ! Boundary.Contains(GetEdgeKey(e)))
+                {
+                    TriangleStates[o/3] = -2;
+                    FloodStack.Emplace(o/3);
+                }
+            }
+        }
+
+        // Write triangles whose circumcircle lies behind the sweep,
+        // no later point can fall inside them
+
+        WrittenTriangles.Reset();
+        WrittenLocalTriangles.Reset();
+
+        for (int32 t=0; t<LocalTriangleCount; ++t)
+        {
+            if (TriangleStates[t] != -1)
+            {
+                continue;
+            }
+
+            const int32 i0 = Triangles[t*3  ];
+            const int32 i1 = Triangles[t*3+1];
+            const int32 i2 = Triangles[t*3+2];
+
+            if (! bLastChunk)
+            {
+                const double ax = ActiveCoords[i0*2], ay = ActiveCoords[i0*2+1];
+                const double dx = ActiveCoords[i1*2] - ax, dy = ActiveCoords[i1*2+1] - ay;
+                const double ex = ActiveCoords[i2*2] - ax, ey = ActiveCoords[i2*2+1] - ay;
+
+                const double bl = dx * dx + dy * dy;
+                const double cl = ex * ex + ey * ey;
+                const double d = dx * ey - dy * ex;
+
+                if (d == 0.0)
+                {
+                    continue;
+                }
+
+                const double x = (ey * bl - dy * cl) * 0.5 / d;
+                const double y = (dx * cl - ex * bl) * 0.5 / d;
+                const double Radius = FMath::Sqrt(x * x + y * y);
+                const double CenterX = ax + x;
+
+                // Small slack, rounding only delays the write
+                if (CenterX + Radius + 1e-7 * (FMath::Abs(CenterX) + Radius) >= SweepX)
+                {
+                    continue;
+                }
+            }
+
+            TriangleStates[t] = static_cast<int32>(TriangleCount) + WrittenTriangles.Num();
+            WrittenLocalTriangles.Emplace(t);
+
+            FDelaunatorStreamTriangle& Triangle(WrittenTriangles.AddDefaulted_GetRef());
+            Triangle.Points[0] = ActiveIndices[i0];
+            Triangle.Points[1] = ActiveIndices[i1];
+            Triangle.Points[2] = ActiveIndices[i2];
+        }
+
+        // Link written halfedges, patch twins written by earlier chunks
+
+        HalfEdgePatches.Reset();
+
+        for (int32 k=0; k<WrittenTriangles.Num(); ++k)
+        {
+            FDelaunatorStreamTriangle& Triangle(WrittenTriangles[k]);
+            // Halfedge ids fit int32 below MaxPointCount
+            const int32 GlobalTriangle = static_cast<int32>(TriangleCount) + k;
+
+            const int32 t = WrittenLocalTriangles[k];
+
+            for (int32 c=0; c<3; ++c)
+            {
+                const int32 e = t*3 + c;
+                const int32 o = HalfEdges[e];
+                const int32 GlobalEdge = GlobalTriangle*3 + c;
+
+                int32 Twin = -1;
+
+                if (o >= 0 && TriangleStates[o/3] >= 0)
+                {
+                    Twin = TriangleStates[o/3]*3 + (o%3);
+                }
+                else
+                {
+                    const uint64 TwinKey = GetTwinKey(e);
+
+                    if (const int32* WrittenEdge = Boundary.Find(TwinKey))
+                    {
+                        Twin = *WrittenEdge;
+                        HalfEdgePatches.Emplace(Twin, GlobalEdge);
+                        Boundary.Remove(TwinKey);
+                    }
+                    else
+                    {
+                        Boundary.Emplace(GetEdgeKey(e), GlobalEdge);
+                    }
+                }
+
+                Triangle.HalfEdges[c] = Twin;
+            }
+
+            // Update page point range
+
+            const int32 PageIndex = GlobalTriangle / PageTriangleCount;
+
+            if (PageIndex == Pages.Num())
+            {
+                FDelaunatorStreamPage& Page(Pages.AddDefaulted_GetRef());
+                Page.MinPoint = MAX_int32;
+                Page.MaxPoint = -1;
+            }
+
+            FDelaunatorStreamPage& Page(Pages[PageIndex]);
+            Page.MinPoint = FMath::Min3(Page.MinPoint, Triangle.Points[0], FMath::Min(Triangle.Points[1], Triangle.Points[2]));
+            Page.MaxPoint = FMath::Max3(Page.MaxPoint, Triangle.Points[0], FMath::Max(Triangle.Points[1], Triangle.Points[2]));
+        }
+
+        if (WrittenTriangles.Num() > 0)
+        {
+            if (! WriteMesh(
+                GetStreamTriangleOffset(TriangleCount),
+                WrittenTriangles.GetData(),
+                WrittenTriangles.Num() * sizeof(FDelaunatorStreamTriangle)
+                ))
+            {
+                return false;
+            }
+
+            HalfEdgePatches.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+            for (const TPair<int32, int32>& Patch : HalfEdgePatches)
+            {
+                const int64 Offset = GetStreamTriangleOffset(Patch.Key / 3)
+                    + STRUCT_OFFSET(FDelaunatorStreamTriangle, HalfEdges)
+                    + (Patch.Key % 3) * sizeof(int32);
+
+                if (! WriteMesh(Offset, &Patch.Value, sizeof(int32)))
+                {
+                    return false;
+                }
+            }
+
+            TriangleCount += WrittenTriangles.Num();
+        }
+
+        // Keep points still referenced by the sweep front
+
+        KeepFlags.Init(false, ActiveCount);
+
+        for (int32 t=0; t<LocalTriangleCount; ++t)
+        {
+            if (TriangleStates[t] == -1)
+            {
+                KeepFlags[Triangles[t*3  ]] = true;
+                KeepFlags[Triangles[t*3+1]] = true;
+                KeepFlags[Triangles[t*3+2]] = true;
+            }
+        }
+
+        int32 h = Delaunator.hull_start;
+        do
+        {
+            KeepFlags[h] = true;
+        }
+        while ((h = Delaunator.hull_next[h]) != Delaunator.hull_start);
+
+        for (const TPair<uint64, int32>& Edge : Boundary)
+        {
+            const int32 a = FindActivePoint(ActiveIndices, static_cast<int32>(Edge.Key >> 32));
+            const int32 b = FindActivePoint(ActiveIndices, static_cast<int32>(Edge.Key & 0xFFFFFFFF));
+
+            if (a >= 0) KeepFlags[a] = true;
+            if (b >= 0) KeepFlags[b] = true;
+        }
+
+        int32 KeepCount = 0;
+
+        for (int32 i=0; i<ActiveCount; ++i)
+        {
+            if (KeepFlags[i])
+            {
+                ActiveIndices[KeepCount] = ActiveIndices[i];
+                ActiveCoords[KeepCount*2  ] = ActiveCoords[i*2  ];
+                ActiveCoords[KeepCount*2+1] = ActiveCoords[i*2+1];
+                ++KeepCount;
+            }
+        }
+
+        ActiveIndices.SetNum(KeepCount, false);
+        ActiveCoords.SetNum(KeepCount*2, false);
+    }
+
+    // Write page table and final header
+
+    Header.TriangleCount = TriangleCount;
+    Header.PageTableOffset = GetStreamTriangleOffset(TriangleCount);
+    Header.PageCount = Pages.Num();
+
+    if (! WriteMesh(Header.PageTableOffset, Pages.GetData(), Pages.Num()*sizeof(FDelaunatorStreamPage)) ||
+        ! WriteMesh(0, &Header, sizeof(Header)))
+    {
+        return false;
+    }
+
+    return TriangleCount > 0;
+}
+
+FDelaunatorStreamMesh::FDelaunatorStreamMesh()
+    : PointData(nullptr)
+    , MaxResidentPages(16)
+    , UseCounter(0)
+{
+    FMemory::Memzero(Header);
+}
+
+FDelaunatorStreamMesh::~FDelaunatorStreamMesh()
+{
+    Close();
+}
+
+bool FDelaunatorStreamMesh::Open(const FString& PointFile, const FString& MeshFile, int32 InMaxResidentPages)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunatorStreamMesh::Open);
+
+    Close();
+
+    IPlatformFile& PlatformFile(FPlatformFileManager::Get().GetPlatformFile());
+
+    MeshHandle.Reset(PlatformFile.OpenMapped(*MeshFile));
+
+    if (! MeshHandle.IsValid() || MeshHandle->GetFileSize() < static_cast<int64>(sizeof(FDelaunatorStreamHeader)))
+    {
+        Close();
+        return false;
+    }
+
+    // Read header and page table
+
+    {
+        TUniquePtr<IMappedFileRegion> HeaderRegion(MeshHandle->MapRegion(0, sizeof(FDelaunatorStreamHeader)));
+
+        if (! HeaderRegion.IsValid())
+        {
+            Close();
+            return false;
+        }
+
+        FMemory::Memcpy(&Header, HeaderRegion->GetMappedPtr(), sizeof(FDelaunatorStreamHeader));
+    }
+
+    const int64 PageTableSize = Header.PageCount * sizeof(FDelaunatorStreamPage);
+
+    if (Header.Magic != FDelaunatorStreamTriangulator::FileMagic   ||
+        Header.Version != FDelaunatorStreamTriangulator::FileVersion ||
+        Header.PageCount < 1 ||
+        Header.PageTableOffset + PageTableSize > MeshHandle->GetFileSize())
+    {
+        UE_LOG(LogDel, Warning, TEXT("FDelaunatorStreamMesh::Open() - Invalid mesh file %s"), *MeshFile);
+        Close();
+        return false;
+    }
+
+    {
+        TUniquePtr<IMappedFileRegion> PageRegion(MeshHandle->MapRegion(Header.PageTableOffset, PageTableSize));
+
+        if (! PageRegion.IsValid())
+        {
+            Close();
+            return false;
+        }
+
+        Pages.SetNumUninitialized(Header.PageCount);
+        FMemory::Memcpy(Pages.GetData(), PageRegion->GetMappedPtr(), PageTableSize);
+    }
+
+    // Map all points, the platform pages them in on access
+
+    PointHandle.Reset(PlatformFile.OpenMapped(*PointFile));
+
+    if (! PointHandle.IsValid() || PointHandle->GetFileSize() != Header.PointCount * sizeof(FVector2D))
+    {
+        Close();
+        return false;
+    }
+
+    PointRegion.Reset(PointHandle->MapRegion(0, PointHandle->GetFileSize()));
+
+    if (! PointRegion.IsValid())
+    {
+        Close();
+        return false;
+    }
+
+    PointData = reinterpret_cast<const FVector2D*>(PointRegion->GetMappedPtr());
+    MaxResidentPages = FMath::Max(1, InMaxResidentPages);
+
+    return true;
+}
+
+void FDelaunatorStreamMesh::Close()
+{
+    // Regions must be released before their file handles
+    ResidentPages.Empty();
+    PointRegion.Reset();
+    PointHandle.Reset();
+    MeshHandle.Reset();
+
+    PointData = nullptr;
+    Pages.Empty();
+    FMemory::Memzero(Header);
+}
+
+TArrayView<const FDelaunatorStreamTriangle> FDelaunatorStreamMesh::GetPage(int32 PageIndex)
+{
+    check(IsOpen());
+    check(Pages.IsValidIndex(PageIndex));
+
+    const int64 FirstTriangle = static_cast<int64>(PageIndex) * Header.PageTriangleCount;
+    const int32 PageTriangles = static_cast<int32>(FMath::Min<int64>(Header.PageTriangleCount, Header.TriangleCount-FirstTriangle));
+
+    auto GetView = [PageTriangles](const FResidentPage& Page)
+    {
+        return MakeArrayView(reinterpret_cast<const FDelaunatorStreamTriangle*>(Page.Region->GetMappedPtr()), PageTriangles);
+    };
+
+    ++UseCounter;
+
+    for (FResidentPage& Page : ResidentPages)
+    {
+        if (Page.PageIndex == PageIndex)
+        {
+            Page.LastUse = UseCounter;
+            return GetView(Page);
+        }
+    }
+
+    // Evict least recently used page
+
+    if (ResidentPages.Num() >= MaxResidentPages)
+    {
+        int32 EvictIndex = 0;
+
+        for (int32 i=1; i<ResidentPages.Num(); ++i)
+        {
+            if (ResidentPages[i].LastUse < ResidentPages[EvictIndex].LastUse)
+            {
+                EvictIndex = i;
+            }
+        }
+
+        ResidentPages.RemoveAtSwap(EvictIndex, 1, false);
+    }
+
+    FResidentPage& Page(ResidentPages.AddDefaulted_GetRef());
+    Page.PageIndex = PageIndex;
+    Page.LastUse = UseCounter;
+    Page.Region.Reset(MeshHandle->MapRegion(
+        GetStreamTriangleOffset(FirstTriangle),
+        PageTriangles * sizeof(FDelaunatorStreamTriangle)
+        ) );
+
+    check(Page.Region.IsValid());
+
+    return GetView(Page);
+}
+
+void FDelaunatorStreamMesh::FindPointRange(float MinX, float MaxX, int32& OutFirst, int32& OutLast) const
+{
+    check(IsOpen());
+
+    const int32 PointCount = GetPointCount();
+
+    // Points are sorted along X, binary search both range ends
+
+    auto LowerBound = [&](float X, bool bInclusive)
+    {
+        int32 First = 0;
+        int32 Count = PointCount;
+
+        while (Count > 0)
+        {
+            const int32 Step = Count / 2;
+            const float PointX = PointData[First+Step].X;
+
+            if (bInclusive ? (PointX <= X) : (PointX < X))
+            {
+                First += Step + 1;
+                Count -= Step + 1;
+            }
+            else
+            {
+                Count = Step;
+            }
+        }
+
+        return First;
+    };
+
+    OutFirst = LowerBound(MinX, false);
+    OutLast = LowerBound(MaxX, true);
+}
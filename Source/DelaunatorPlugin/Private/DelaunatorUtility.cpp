@@ -29,9 +29,14 @@
 #include "delaunator/delaunator.hpp"
 #include "DelaunatorObject.h"
 #include "GULMathLibrary.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 UDelaunatorObject* UDelaunatorUtility::GenerateDelaunatorObject(UObject* Outer, const TArray<FVector2D>& InPoints)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateDelaunatorObject);
+
     if (InPoints.Num() < 3)
     {
         return nullptr;
@@ -49,8 +54,10 @@ UDelaunatorObject* UDelaunatorUtility::GenerateDelaunatorObject(UObject* Outer,
 
 void UDelaunatorUtility::GenerateDelaunatorTriangles(TArray<FIntVector>& OutTriangles, const TArray<FVector2D>& InPoints)
 {
-    const float* PointData = reinterpret_cast<const float*>(InPoints.GetData());
-    delaunator::Delaunator Delaunator(PointData, InPoints.Num()*2);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateDelaunatorTriangles);
+
+    delaunator::Delaunator Delaunator;
+    Delaunator.update(InPoints);
 
     const int32 TriCount = Delaunator.triangles.Num() / 3;
 
@@ -72,8 +79,10 @@ void UDelaunatorUtility::GenerateDelaunatorTriangles(TArray<FIntVector>& OutTria
 
 void UDelaunatorUtility::GenerateDelaunatorIndices(TArray<int32>& OutTriangles, TArray<int32>& OutHalfEdges, const TArray<FVector2D>& InPoints)
 {
-    const float* PointData = reinterpret_cast<const float*>(InPoints.GetData());
-    delaunator::Delaunator Delaunator(PointData, InPoints.Num()*2);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateDelaunatorIndices);
+
+    delaunator::Delaunator Delaunator;
+    Delaunator.update(InPoints);
 
     check(Delaunator.triangles.Num() == Delaunator.halfedges.Num());
 
@@ -81,6 +90,118 @@ void UDelaunatorUtility::GenerateDelaunatorIndices(TArray<int32>& OutTriangles,
     OutHalfEdges = MoveTemp(Delaunator.halfedges);
 }
 
+void UDelaunatorUtility::GenerateDelaunatorIndicesBatch(
+    TArray<int32>& OutTriangles,
+    TArray<int32>& OutHalfEdges,
+    TArray<int32>& OutChunkIndexOffsets,
+    const TArray<FVector2D>& InPoints,
+    const TArray<int32>& InChunkOffsets
+    )
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateDelaunatorIndicesBatch);
+
+    OutTriangles.Reset();
+    OutHalfEdges.Reset();
+    OutChunkIndexOffsets.Reset();
+
+    const int32 ChunkCount = InChunkOffsets.Num();
+    const int32 PointCount = InPoints.Num();
+
+    if (ChunkCount < 1)
+    {
+        return;
+    }
+
+    // Per-worker triangulator and result buffers, triangulators keep
+    // their workspace between chunks
+
+    struct FWorkerData
+    {
+        delaunator::Delaunator Delaunator;
+        TArray<int32> Triangles;
+        TArray<int32> HalfEdges;
+    };
+
+    const int32 WorkerCount = FMath::Clamp(
+        FPlatformMisc::NumberOfCoresIncludingHyperthreads(),
+        1,
+        ChunkCount
+        );
+
+    TArray<FWorkerData> Workers;
+    Workers.SetNum(WorkerCount);
+
+    TArray<int32> ChunkWorker;
+    TArray<int32> ChunkLocalOffset;
+    ChunkWorker.SetNumUninitialized(ChunkCount);
+    ChunkLocalOffset.SetNumUninitialized(ChunkCount);
+    OutChunkIndexOffsets.SetNumZeroed(ChunkCount+1);
+
+    FThreadSafeCounter NextChunk;
+
+    ParallelFor(WorkerCount, [&](int32 w)
+    {
+        FWorkerData& Worker(Workers[w]);
+        delaunator::Delaunator& Delaunator(Worker.Delaunator);
+        Delaunator.retain_capacity = true;
+
+        for (int32 c = NextChunk.Increment()-1; c < ChunkCount; c = NextChunk.Increment()-1)
+        {
+            const int32 Start = InChunkOffsets[c];
+            const int32 End = (c+1) < ChunkCount ? InChunkOffsets[c+1] : PointCount;
+
+            ChunkWorker[c] = w;
+            ChunkLocalOffset[c] = Worker.Triangles.Num();
+
+            // Skip invalid spans and chunks without enough points
+            if (Start < 0 || End > PointCount || (End-Start) < 3)
+            {
+                continue;
+            }
+
+            Delaunator.coords = MakeArrayView(&InPoints[Start].X, (End-Start)*2);
+            Delaunator.update();
+
+            Worker.Triangles.Append(Delaunator.triangles);
+            Worker.HalfEdges.Append(Delaunator.halfedges);
+
+            OutChunkIndexOffsets[c+1] = Delaunator.triangles.Num();
+        }
+    } );
+
+    // Chunk index counts to output offsets
+
+    for (int32 c=0; c<ChunkCount; ++c)
+    {
+        OutChunkIndexOffsets[c+1] += OutChunkIndexOffsets[c];
+    }
+
+    const int32 IndexCount = OutChunkIndexOffsets[ChunkCount];
+
+    OutTriangles.SetNumUninitialized(IndexCount);
+    OutHalfEdges.SetNumUninitialized(IndexCount);
+
+    // Copy worker results to shared buffer with global point
+    // and half edge indices
+
+    ParallelFor(ChunkCount, [&](int32 c)
+    {
+        const FWorkerData& Worker(Workers[ChunkWorker[c]]);
+        const int32 SrcOffset = ChunkLocalOffset[c];
+        const int32 DstOffset = OutChunkIndexOffsets[c];
+        const int32 Count = OutChunkIndexOffsets[c+1] - DstOffset;
+        const int32 PointOffset = InChunkOffsets[c];
+
+        for (int32 i=0; i<Count; ++i)
+        {
+            const int32 HalfEdge = Worker.HalfEdges[SrcOffset+i];
+
+            OutTriangles[DstOffset+i] = Worker.Triangles[SrcOffset+i] + PointOffset;
+            OutHalfEdges[DstOffset+i] = HalfEdge < 0 ? -1 : HalfEdge + DstOffset;
+        }
+    } );
+}
+
 void UDelaunatorUtility::GenerateJitteredGridPoints(
     TArray<FVector2D>& OutPoints,
     int32& OutBoundaryPointOffset,
@@ -90,6 +211,8 @@ void UDelaunatorUtility::GenerateJitteredGridPoints(
     int32 ExpansionCount
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateJitteredGridPoints);
+
     OutPoints.Reset();
 
     if (CellCountPerDimension < 1   ||
@@ -227,6 +350,8 @@ void UDelaunatorUtility::GenerateJitteredGridPointsUniform(
     int32 ExpansionCount
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorUtility::GenerateJitteredGridPointsUniform);
+
     checkf(false, TEXT("NO IMPLEMENTATION"));
 
 #if 0
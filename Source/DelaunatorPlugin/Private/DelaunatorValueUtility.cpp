@@ -26,9 +26,11 @@
 // 
 
 #include "DelaunatorValueUtility.h"
+#include "DelaunatorPlugin.h"
 #include "Geom/GULGeometryUtilityLibrary.h"
 #include "Poly/GULPolyTypes.h"
 #include "Poly/GULPolyUtilityLibrary.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 void UDelaunatorValueUtility::PointFillVisit(
     UDelaunatorObject* Delaunator,
@@ -37,6 +39,8 @@ void UDelaunatorValueUtility::PointFillVisit(
     TFunction<void(int32)> InVisitCallback
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::PointFillVisit);
+
     if (! IsValidDelaunay(Delaunator) ||
         ! Delaunator->GetPoints().IsValidIndex(InitialPoint))
     {
@@ -84,16 +88,15 @@ void UDelaunatorValueUtility::PointFillVisit(
     VisitCallback(InitialPoint);
 
     TArray<int32> NeighbourCells;
+    uint32 VisitCount = 0;
 
     while (! VisitQueue.IsEmpty())
     {
         int32 PointIndex;
         VisitQueue.Dequeue(PointIndex);
+        ++VisitCount;
 
-        NeighbourCells.Reset();
-        Delaunator->GetPointNeighbours(NeighbourCells, PointIndex);
-
-        for (int32 NeighbourCell : NeighbourCells)
+        for (int32 NeighbourCell : Delaunator->GetPointNeighboursView(PointIndex, NeighbourCells))
         {
             if (! VisitedFlags[NeighbourCell])
             {
@@ -102,6 +105,8 @@ void UDelaunatorValueUtility::PointFillVisit(
             }
         }
     }
+
+    INC_DWORD_STAT_BY(STAT_DelaunatorVisitedNodes, VisitCount);
 }
 
 void UDelaunatorValueUtility::ExpandPointValueVisit(
@@ -113,6 +118,8 @@ void UDelaunatorValueUtility::ExpandPointValueVisit(
     const TBitArray<>* InVisitedFlags
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::ExpandPointValueVisit);
+
     if (! IsValidDelaunay(Delaunator))
     {
         return;
@@ -151,16 +158,15 @@ void UDelaunatorValueUtility::ExpandPointValueVisit(
     // Expand values
 
     TArray<int32> NeighbourPoints;
+    uint32 VisitCount = 0;
 
     while (! VisitQueue.IsEmpty())
     {
         int32 PointIndex;
         VisitQueue.Dequeue(PointIndex);
+        ++VisitCount;
 
-        NeighbourPoints.Reset();
-        Delaunator->GetPointNeighbours(NeighbourPoints, PointIndex);
-
-        for (int32 ni : NeighbourPoints)
+        for (int32 ni : Delaunator->GetPointNeighboursView(PointIndex, NeighbourPoints))
         {
             if (! VisitedFlags[ni] && ExpandFilterCallback(ni))
             {
@@ -170,6 +176,8 @@ void UDelaunatorValueUtility::ExpandPointValueVisit(
             }
         }
     }
+
+    INC_DWORD_STAT_BY(STAT_DelaunatorVisitedNodes, VisitCount);
 }
 
 void UDelaunatorValueUtility::GeneratePointsDepthValues(
@@ -180,6 +188,8 @@ void UDelaunatorValueUtility::GeneratePointsDepthValues(
     UDelaunatorCompareOperatorLogic* CompareOperator
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GeneratePointsDepthValues);
+
     if (! IsValid(ValueObject)        ||
         ! IsValidDelaunay(Delaunator) ||
         ! ValueObject->IsValidElementCount(Delaunator->GetPointCount()))
@@ -234,6 +244,8 @@ void UDelaunatorValueUtility::GetBorderPoints(
     const TArray<int32>& InPoints
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetBorderPoints);
+
     OutBorderPoints.Reset();
 
     if (! IsValidDelaunay(Delaunator) || InPoints.Num() < 1)
@@ -294,6 +306,8 @@ void UDelaunatorValueUtility::ExpandPoints(
     int32 ExpandCount
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::ExpandPoints);
+
     OutPoints.Reset();
     OutPointCounts.Reset();
 
@@ -380,6 +394,8 @@ void UDelaunatorValueUtility::ExpandPointValues(
     UDelaunatorCompareOperatorLogic* CompareOperator
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::ExpandPointValues);
+
     if (! IsValid(ValueObject)        ||
         ! IsValidDelaunay(Delaunator) ||
         ! ValueObject->IsValidElementCount(Delaunator->GetPointCount()))
@@ -429,6 +445,8 @@ void UDelaunatorValueUtility::FilterPointsByNeighbours(
     UDelaunatorCompareOperatorLogic* CompareOperator
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::FilterPointsByNeighbours);
+
     OutPoints.Reset();
 
     if (! IsValidDelaunay(Delaunator) || InPoints.Num() < 1)
@@ -460,12 +478,9 @@ void UDelaunatorValueUtility::FilterPointsByNeighbours(
 
     for (int32 PointIndex : InPoints)
     {
-        NeighbourPoints.Reset();
-        Delaunator->GetPointNeighbours(NeighbourPoints, PointIndex);
-
         bool bHasValidNeighbour = false;
 
-        for (int32 NeighbourPoint : NeighbourPoints)
+        for (int32 NeighbourPoint : Delaunator->GetPointNeighboursView(PointIndex, NeighbourPoints))
         {
             if (FilterCallback(NeighbourPoint))
             {
@@ -493,6 +508,8 @@ void UDelaunatorValueUtility::GetRandomFilteredPointsWithinRadius(
     UDelaunatorCompareOperatorLogic* CompareOperator
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetRandomFilteredPointsWithinRadius);
+
     OutPointIndices.Reset();
 
     if (! IsValidDelaunay(Delaunator) || InPointIndices.Num() < 1)
@@ -577,6 +594,8 @@ void UDelaunatorValueUtility::MarkCellsWithinIndexedPolyGroups(
     const TArray<FGULVector2DGroup>& InPolyGroups
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::MarkCellsWithinIndexedPolyGroups);
+
     OutBoundaryCellGroups.Reset();
 
     if (! IsValidVoronoi(Voronoi) ||
@@ -646,10 +665,7 @@ void UDelaunatorValueUtility::MarkCellsWithinIndexedPolyGroups(
 
         for (int32 BoundaryCell : BoundaryCells)
         {
-            NeighbourCells.Reset();
-            Delaunator->GetPointNeighbours(NeighbourCells, BoundaryCell);
-
-            for (int32 NeighbourCell : NeighbourCells)
+            for (int32 NeighbourCell : Delaunator->GetPointNeighboursView(BoundaryCell, NeighbourCells))
             {
                 // Skip visited cells
                 if (MarkedCells[NeighbourCell])
@@ -688,6 +704,8 @@ void UDelaunatorValueUtility::FindSegmentIntersectCells(
     int32 InitialPoint
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::FindSegmentIntersectCells);
+
     OutCells.Reset();
 
     if (! IsValidVoronoi(Voronoi) ||
@@ -783,6 +801,8 @@ void UDelaunatorValueUtility::FindPolyIntersectCells(
     int32 InitialPoint
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::FindPolyIntersectCells);
+
     OutCells.Reset();
 
     const int32 PolyPointCount = InPolyPoints.Num();
@@ -861,6 +881,8 @@ bool UDelaunatorValueUtility::GetCellsOuterConnections(
     const TArray<int32>& InCells
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetCellsOuterConnections);
+
     OutPoints.Reset();
 
     if (! IsValidVoronoi(Voronoi) || InCells.Num() < 3)
@@ -965,6 +987,8 @@ bool UDelaunatorValueUtility::GetCellsOuterConnections(
 
 void UDelaunatorValueUtility::OptimizeCellBorders(TArray<int32>& OutCells, const TArray<int32>& InCells)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::OptimizeCellBorders);
+
     const int32 CellCount = InCells.Num();
     const int32 LastCellIndex = CellCount-1;
 
@@ -1058,6 +1082,8 @@ void UDelaunatorValueUtility::GetCellsBordersSorted(
     const TArray<int32>& InCells
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetCellsBordersSorted);
+
     OutBorderCells.Reset();
 
     if (! IsValidVoronoi(Voronoi) || InCells.Num() < 1)
@@ -1082,10 +1108,7 @@ void UDelaunatorValueUtility::GetCellsBordersSorted(
 
     for (int32 i : InCells)
     {
-        NeighbourCells.Reset();
-        Delaunator->GetPointNeighbours(NeighbourCells, i);
-
-        for (int32 ni : NeighbourCells)
+        for (int32 ni : Delaunator->GetPointNeighboursView(i, NeighbourCells))
         {
             if (! InputSet.Contains(ni))
             {
@@ -1192,6 +1215,8 @@ void UDelaunatorValueUtility::GetCellsBorderGroups(
     const TArray<int32>& InCells
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetCellsBorderGroups);
+
     OutBorderCellGroups.Reset();
 
     if (! IsValidVoronoi(Voronoi) || InCells.Num() < 1)
@@ -1219,10 +1244,9 @@ void UDelaunatorValueUtility::GetCellsBorderGroups(
             int32 CandidateCell = InCells[CandidateIndex];
 
             TArray<int32> NeighbourCells;
-            Delaunator->GetPointNeighbours(NeighbourCells, CandidateCell);
 
             // Find any invalid cell
-            for (int32 ni : NeighbourCells)
+            for (int32 ni : Delaunator->GetPointNeighboursView(CandidateCell, NeighbourCells))
             {
                 if (! InputCellSet.Contains(ni) && ! InvalidCellSet.Contains(ni))
                 {
@@ -1333,6 +1357,8 @@ void UDelaunatorValueUtility::GetCellsBorderEdgesByCompareOperator(
     UDelaunatorCompareOperatorLogic* CompareOperator
     )
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorValueUtility::GetCellsBorderEdgesByCompareOperator);
+
     OutBorderEdgeGroups.Reset();
 
     if (! IsValidVoronoi(Voronoi) || InCells.Num() < 1)
@@ -27,9 +27,12 @@
 
 #include "DelaunatorVoronoi.h"
 #include "Geom/GULGeometryUtilityLibrary.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 void UDelaunatorVoronoi::Update()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorVoronoi::Update);
+
     if (! HasValidDelaunatorObject())
     {
         return;
@@ -128,6 +131,8 @@ UDelaunatorValueObject* UDelaunatorVoronoi::CreateDefaultCellValueObject(
 
 void UDelaunatorVoronoi::GetAllCellPoints(TArray<FGULVector2DGroup>& OutPointGroups) const
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorVoronoi::GetAllCellPoints);
+
     if (HasValidDelaunatorObject())
     {
         const int32 PointCount = Delaunator->GetPointCount();
@@ -143,6 +148,8 @@ void UDelaunatorVoronoi::GetAllCellPoints(TArray<FGULVector2DGroup>& OutPointGro
 
 void UDelaunatorVoronoi::GetCellPointsByPointIndices(TArray<FGULVector2DGroup>& OutPointGroups, const TArray<int32>& InPointIndices) const
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDelaunatorVoronoi::GetCellPointsByPointIndices);
+
     if (HasValidDelaunatorObject())
     {
         const int32 PointCount = InPointIndices.Num();
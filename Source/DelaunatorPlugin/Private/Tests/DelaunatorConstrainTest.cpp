@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "delaunator/delaunator.hpp"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+
+using FTestDelaunator = delaunator::TDelaunator<double>;
+
+FORCEINLINE int32 NextHalfEdge(int32 e)
+{
+    return ((e%3) == 2) ? e-2 : e+1;
+}
+
+bool SegmentsCross(const TArray<double>& Coords, int32 a, int32 b, int32 c, int32 d)
+{
+    auto Side = [&](int32 p, int32 q, int32 r)
+    {
+        const double Cross =
+            (Coords[2*q] - Coords[2*p]) * (Coords[2*r+1] - Coords[2*p+1]) -
+            (Coords[2*q+1] - Coords[2*p+1]) * (Coords[2*r] - Coords[2*p]);
+        return (Cross > 0.0) - (Cross < 0.0);
+    };
+
+    return Side(a, b, c) * Side(a, b, d) < 0 && Side(c, d, a) * Side(c, d, b) < 0;
+}
+
+int32 FindIncomingEdge(const FTestDelaunator& Delaunator, int32 PointIndex)
+{
+    for (int32 e=0; e<Delaunator.triangles.Num(); ++e)
+    {
+        if (Delaunator.triangles[NextHalfEdge(e)] == PointIndex)
+        {
+            return e;
+        }
+    }
+
+    return delaunator::INVALID_INDEX;
+}
+
+// Returns the number of halfedges with a broken twin link
+int32 CountBrokenEdges(const FTestDelaunator& Delaunator)
+{
+    const TArray<int32>& Triangles(Delaunator.triangles);
+    const TArray<int32>& Halfedges(Delaunator.halfedges);
+
+    int32 BrokenCount = 0;
+
+    for (int32 e=0; e<Halfedges.Num(); ++e)
+    {
+        const int32 o = Halfedges[e];
+
+        if (o == delaunator::INVALID_INDEX)
+        {
+            continue;
+        }
+
+        const bool bSymmetric = Halfedges.IsValidIndex(o) && Halfedges[o] == e;
+        const bool bEndpoints = bSymmetric
+            && Triangles[e] == Triangles[NextHalfEdge(o)]
+            && Triangles[o] == Triangles[NextHalfEdge(e)];
+        const bool bFlags = bSymmetric && Delaunator.is_constrained(e) == Delaunator.is_constrained(o);
+
+        if (! bEndpoints || ! bFlags)
+        {
+            ++BrokenCount;
+        }
+    }
+
+    return BrokenCount;
+}
+
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunatorConstrainTest, "Delaunator.Constrain.Topology", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDelaunatorConstrainTest::RunTest(const FString& Parameters)
+{
+    // Random non-crossing constraints over uniform point sets, the mesh
+    // must stay consistent after every insertion
+
+    for (int32 Seed=0; Seed<100; ++Seed)
+    {
+        FRandomStream Rand(Seed);
+
+        const int32 PointCount = 20 + Seed % 40;
+
+        TArray<double> Coords;
+        Coords.SetNumUninitialized(PointCount*2);
+
+        for (int32 i=0; i<Coords.Num(); ++i)
+        {
+            Coords[i] = Rand.FRandRange(0.f, 1000.f);
+        }
+
+        FTestDelaunator Delaunator;
+        Delaunator.coords = MakeArrayView(Coords);
+        Delaunator.update();
+
+        const int32 TriangleCount = Delaunator.triangles.Num() / 3;
+
+        TArray<FIntPoint> Segments;
+
+        for (int32 Step=0; Step<20; ++Step)
+        {
+            const int32 a = Rand.RandHelper(PointCount);
+            const int32 b = Rand.RandHelper(PointCount);
+
+            bool bCrossing = (a == b);
+
+            for (const FIntPoint& Segment : Segments)
+            {
+                if (bCrossing)
+                {
+                    break;
+                }
+
+                bCrossing = SegmentsCross(Coords, a, b, Segment.X, Segment.Y);
+            }
+
+            if (bCrossing)
+            {
+                continue;
+            }
+
+            const bool bInserted = Delaunator.constrain(a, FindIncomingEdge(Delaunator, a), b);
+
+            if (! TestTrue(FString::Printf(TEXT("Seed %d inserts constraint %d-%d"), Seed, a, b), bInserted))
+            {
+                return false;
+            }
+
+            Segments.Emplace(a, b);
+
+            const int32 BrokenCount = CountBrokenEdges(Delaunator);
+
+            if (BrokenCount > 0)
+            {
+                AddError(FString::Printf(TEXT("Seed %d constraint %d-%d leaves %d broken halfedges"), Seed, a, b, BrokenCount));
+                return false;
+            }
+
+            if (Delaunator.triangles.Num() / 3 != TriangleCount)
+            {
+                AddError(FString::Printf(TEXT("Seed %d constraint %d-%d changes the triangle count"), Seed, a, b));
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
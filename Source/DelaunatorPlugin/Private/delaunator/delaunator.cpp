@@ -1,9 +1,606 @@
 #include "delaunator/delaunator.hpp"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
 
 namespace delaunator
 {
 
-Delaunator::Delaunator()
+namespace
+{
+
+template<typename FReal, typename FIndex>
+struct slab_data
+{
+    // global point ids and local interleaved coordinates
+    TIndexArray<FIndex> ids;
+    TArray<FReal> coords;
+
+    FReal min_x;
+    FReal max_x;
+
+    // final triangles with global point ids and slab-local halfedges,
+    // edges bordering the seam are listed in seam_edges
+    TIndexArray<FIndex> triangles;
+    TIndexArray<FIndex> halfedges;
+    TIndexArray<FIndex> seam_edges;
+    TIndexArray<FIndex> seam_partners;
+
+    FIndex triangle_offset;
+    bool valid;
+};
+
+template<typename FIndex>
+FORCEINLINE FIndex next_halfedge(FIndex e)
+{
+    return (e % 3 == 2) ? e - 2 : e + 1;
+}
+
+template<typename FIndex>
+FORCEINLINE FIndex prev_halfedge(FIndex e)
+{
+    return (e % 3 == 0) ? e + 2 : e - 1;
+}
+
+template<typename FReal>
+bool is_collinear(const TArray<FReal>& xy)
+{
+    const FIndex n = xy.Num() >> 1;
+
+    if (n < 3)
+    {
+        return true;
+    }
+
+    const FReal x0 = xy[0];
+    const FReal y0 = xy[1];
+
+    FIndex i1 = 1;
+
+    for (; i1 < n; ++i1)
+    {
+        if (dist(x0, y0, xy[2 * i1], xy[2 * i1 + 1]) > 0)
+        {
+            break;
+        }
+    }
+
+    for (FIndex i = i1 + 1; i < n; ++i)
+    {
+        const FReal r = circumradius(
+            x0, y0, xy[2 * i1], xy[2 * i1 + 1], xy[2 * i], xy[2 * i + 1]);
+
+        if (r < TNumericLimits<FReal>::Max())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// hilbert curve distance of a cell on a 2^16 x 2^16 grid
+FORCEINLINE uint32 hilbert_index(uint32 x, uint32 y)
+{
+    uint32 d = 0;
+
+    for (uint32 s = 1u << 15; s > 0; s >>= 1)
+    {
+        const uint32 rx = (x & s) > 0;
+        const uint32 ry = (y & s) > 0;
+
+        d += s * s * ((3 * rx) ^ ry);
+
+        // rotate quadrant
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = 0xFFFF - x;
+                y = 0xFFFF - y;
+            }
+
+            Swap(x, y);
+        }
+    }
+
+    return d;
+}
+
+// pre-sort scan kernels over points [begin, end). The float overloads
+// evaluate four points per VectorRegister op and rescan only the groups
+// that may hold a new minimum, keeping the scalar kernel results.
+
+// relative prefilter slack against vector and scalar rounding differences
+constexpr float SCAN_PREFILTER_SLACK = 1.0001f;
+
+// points per distance block of the sort key pass
+constexpr FIndex SCAN_BLOCK_SIZE = 256;
+
+template<typename FIndex>
+FORCEINLINE FIndex get_scan_chunk_count(FIndex n)
+{
+    return FMath::Max<FIndex>(1, n / SCAN_CHUNK_SIZE);
+}
+
+template<typename FIndex>
+FORCEINLINE FIndex get_chunk_start(FIndex n, FIndex chunk_count, int32 c)
+{
+    return static_cast<FIndex>(int64(n) * c / chunk_count);
+}
+
+template<typename FIndex>
+FORCEINLINE void load_points(const float* xy, FIndex i, VectorRegister& out_x, VectorRegister& out_y)
+{
+    const VectorRegister a = VectorLoad(xy + 2 * i);
+    const VectorRegister b = VectorLoad(xy + 2 * i + 4);
+    out_x = VectorShuffle(a, b, 0, 2, 0, 2);
+    out_y = VectorShuffle(a, b, 1, 3, 1, 3);
+}
+
+template<typename FReal, typename FIndex>
+void scan_bounds(const FReal* xy, FIndex begin, FIndex end, FReal* bounds)
+{
+    for (FIndex i = begin; i < end; ++i)
+    {
+        bounds[0] = FMath::Min(bounds[0], xy[2 * i]);
+        bounds[1] = FMath::Min(bounds[1], xy[2 * i + 1]);
+        bounds[2] = FMath::Max(bounds[2], xy[2 * i]);
+        bounds[3] = FMath::Max(bounds[3], xy[2 * i + 1]);
+    }
+}
+
+template<typename FIndex>
+void scan_bounds(const float* xy, FIndex begin, FIndex end, float* bounds)
+{
+    VectorRegister lo = MakeVectorRegister(bounds[0], bounds[1], bounds[0], bounds[1]);
+    VectorRegister hi = MakeVectorRegister(bounds[2], bounds[3], bounds[2], bounds[3]);
+
+    FIndex i = begin;
+
+    for (; i + 2 <= end; i += 2)
+    {
+        const VectorRegister p = VectorLoad(xy + 2 * i);
+        lo = VectorMin(lo, p);
+        hi = VectorMax(hi, p);
+    }
+
+    float lo_xyxy[4];
+    float hi_xyxy[4];
+    VectorStore(lo, lo_xyxy);
+    VectorStore(hi, hi_xyxy);
+
+    bounds[0] = FMath::Min(lo_xyxy[0], lo_xyxy[2]);
+    bounds[1] = FMath::Min(lo_xyxy[1], lo_xyxy[3]);
+    bounds[2] = FMath::Max(hi_xyxy[0], hi_xyxy[2]);
+    bounds[3] = FMath::Max(hi_xyxy[1], hi_xyxy[3]);
+
+    scan_bounds<float, FIndex>(xy, i, end, bounds);
+}
+
+// nearest point to [px, py], optionally skipping coincident points
+template<typename FReal, typename FIndex>
+void scan_nearest(
+    const FReal* xy,
+    FIndex begin,
+    FIndex end,
+    FReal px,
+    FReal py,
+    bool skip_coincident,
+    FReal& best,
+    FIndex& best_index)
+{
+    for (FIndex i = begin; i < end; ++i)
+    {
+        const FReal d = dist(px, py, xy[2 * i], xy[2 * i + 1]);
+
+        if (d < best && (! skip_coincident || d > 0.0))
+        {
+            best = d;
+            best_index = i;
+        }
+    }
+}
+
+template<typename FIndex>
+void scan_nearest(
+    const float* xy,
+    FIndex begin,
+    FIndex end,
+    float px,
+    float py,
+    bool skip_coincident,
+    float& best,
+    FIndex& best_index)
+{
+    const VectorRegister vpx = VectorSetFloat1(px);
+    const VectorRegister vpy = VectorSetFloat1(py);
+
+    FIndex i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        VectorRegister x;
+        VectorRegister y;
+        load_points(xy, i, x, y);
+
+        const VectorRegister dx = VectorSubtract(vpx, x);
+        const VectorRegister dy = VectorSubtract(vpy, y);
+        const VectorRegister d = VectorMultiplyAdd(dx, dx, VectorMultiply(dy, dy));
+
+        if (VectorMaskBits(VectorCompareLT(d, VectorSetFloat1(best * SCAN_PREFILTER_SLACK))))
+        {
+            scan_nearest<float, FIndex>(xy, i, i + 4, px, py, skip_coincident, best, best_index);
+        }
+    }
+
+    scan_nearest<float, FIndex>(xy, i, end, px, py, skip_coincident, best, best_index);
+}
+
+// smallest circumcircle with the edge [a, b], skipping the edge points
+template<typename FReal, typename FIndex>
+void scan_circumradius(
+    const FReal* xy,
+    FIndex begin,
+    FIndex end,
+    FIndex ia,
+    FIndex ib,
+    FReal ax,
+    FReal ay,
+    FReal bx,
+    FReal by,
+    FReal& best,
+    FIndex& best_index)
+{
+    for (FIndex i = begin; i < end; ++i)
+    {
+        if (i == ia || i == ib) continue;
+
+        const FReal r = circumradius(ax, ay, bx, by, xy[2 * i], xy[2 * i + 1]);
+
+        if (r < best)
+        {
+            best = r;
+            best_index = i;
+        }
+    }
+}
+
+template<typename FIndex>
+void scan_circumradius(
+    const float* xy,
+    FIndex begin,
+    FIndex end,
+    FIndex ia,
+    FIndex ib,
+    float ax,
+    float ay,
+    float bx,
+    float by,
+    float& best,
+    FIndex& best_index)
+{
+    const float dx = bx - ax;
+    const float dy = by - ay;
+    const float bl = dx * dx + dy * dy;
+
+    const VectorRegister vax = VectorSetFloat1(ax);
+    const VectorRegister vay = VectorSetFloat1(ay);
+    const VectorRegister vdx = VectorSetFloat1(dx);
+    const VectorRegister vdy = VectorSetFloat1(dy);
+    const VectorRegister vbl = VectorSetFloat1(bl);
+    const VectorRegister half = VectorSetFloat1(0.5f);
+
+    FIndex i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        VectorRegister x;
+        VectorRegister y;
+        load_points(xy, i, x, y);
+
+        // degenerate lanes divide by zero and fail the compare
+        const VectorRegister ex = VectorSubtract(x, vax);
+        const VectorRegister ey = VectorSubtract(y, vay);
+        const VectorRegister cl = VectorMultiplyAdd(ex, ex, VectorMultiply(ey, ey));
+        const VectorRegister d = VectorSubtract(VectorMultiply(vdx, ey), VectorMultiply(vdy, ex));
+        const VectorRegister scale = VectorDivide(half, d);
+        const VectorRegister cx = VectorMultiply(VectorSubtract(VectorMultiply(ey, vbl), VectorMultiply(vdy, cl)), scale);
+        const VectorRegister cy = VectorMultiply(VectorSubtract(VectorMultiply(vdx, cl), VectorMultiply(ex, vbl)), scale);
+        const VectorRegister r = VectorMultiplyAdd(cx, cx, VectorMultiply(cy, cy));
+
+        if (VectorMaskBits(VectorCompareLT(r, VectorSetFloat1(best * SCAN_PREFILTER_SLACK))))
+        {
+            scan_circumradius<float, FIndex>(xy, i, i + 4, ia, ib, ax, ay, bx, by, best, best_index);
+        }
+    }
+
+    scan_circumradius<float, FIndex>(xy, i, end, ia, ib, ax, ay, bx, by, best, best_index);
+}
+
+// squared distances to [cx, cy] written from out_dists[0]
+template<typename FReal, typename FIndex>
+void scan_dists(const FReal* xy, FIndex begin, FIndex end, FReal cx, FReal cy, FReal* out_dists)
+{
+    for (FIndex i = begin; i < end; ++i)
+    {
+        out_dists[i - begin] = dist(xy[2 * i], xy[2 * i + 1], cx, cy);
+    }
+}
+
+template<typename FIndex>
+void scan_dists(const float* xy, FIndex begin, FIndex end, float cx, float cy, float* out_dists)
+{
+    const VectorRegister vcx = VectorSetFloat1(cx);
+    const VectorRegister vcy = VectorSetFloat1(cy);
+
+    FIndex i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        VectorRegister x;
+        VectorRegister y;
+        load_points(xy, i, x, y);
+
+        const VectorRegister dx = VectorSubtract(x, vcx);
+        const VectorRegister dy = VectorSubtract(y, vcy);
+        VectorStore(VectorMultiplyAdd(dx, dx, VectorMultiply(dy, dy)), out_dists + (i - begin));
+    }
+
+    scan_dists<float, FIndex>(xy, i, end, cx, cy, out_dists + (i - begin));
+}
+
+/* expansion arithmetic for the exact predicates, expansions are stored
+ * as nonoverlapping components in increasing magnitude order
+ * @see J. R. Shewchuk, Adaptive Precision Floating-Point Arithmetic
+ *      and Fast Robust Geometric Predicates
+ */
+
+constexpr double SPLITTER = 134217729.0; // 2^27 + 1
+
+FORCEINLINE void two_sum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    const double bvirt = x - a;
+    const double avirt = x - bvirt;
+    y = (a - avirt) + (b - bvirt);
+}
+
+FORCEINLINE void split(double a, double& hi, double& lo)
+{
+    const double c = SPLITTER * a;
+    const double abig = c - a;
+    hi = c - abig;
+    lo = a - hi;
+}
+
+FORCEINLINE void two_product(double a, double b, double& x, double& y)
+{
+    double ahi, alo, bhi, blo;
+    x = a * b;
+    split(a, ahi, alo);
+    split(b, bhi, blo);
+    const double err1 = x - ahi * bhi;
+    const double err2 = err1 - alo * bhi;
+    const double err3 = err2 - ahi * blo;
+    y = alo * blo - err3;
+}
+
+// h = e + f, zero components eliminated
+int32 expansion_sum(int32 elen, const double* e, int32 flen, const double* f, double* h)
+{
+    int32 eindex = 0;
+    int32 findex = 0;
+    int32 hindex = 0;
+    double q = 0.0;
+    double hh;
+
+    while (eindex < elen || findex < flen)
+    {
+        double next;
+
+        if (findex >= flen || (eindex < elen && FMath::Abs(e[eindex]) < FMath::Abs(f[findex])))
+        {
+            next = e[eindex++];
+        }
+        else
+        {
+            next = f[findex++];
+        }
+
+        two_sum(q, next, q, hh);
+
+        if (hh != 0.0)
+        {
+            h[hindex++] = hh;
+        }
+    }
+
+    if (q != 0.0 || hindex == 0)
+    {
+        h[hindex++] = q;
+    }
+
+    return hindex;
+}
+
+// h = e * b, zero components eliminated
+int32 scale_expansion(int32 elen, const double* e, double b, double* h)
+{
+    int32 hindex = 0;
+    double q;
+    double hh;
+
+    two_product(e[0], b, q, hh);
+
+    if (hh != 0.0)
+    {
+        h[hindex++] = hh;
+    }
+
+    for (int32 i = 1; i < elen; ++i)
+    {
+        double product1, product0, sum;
+        two_product(e[i], b, product1, product0);
+        two_sum(q, product0, sum, hh);
+
+        if (hh != 0.0)
+        {
+            h[hindex++] = hh;
+        }
+
+        two_sum(product1, sum, q, hh);
+
+        if (hh != 0.0)
+        {
+            h[hindex++] = hh;
+        }
+    }
+
+    if (q != 0.0 || hindex == 0)
+    {
+        h[hindex++] = q;
+    }
+
+    return hindex;
+}
+
+// h = a * b - c * d
+int32 product_diff(double a, double b, double c, double d, double* h)
+{
+    double ab[2];
+    double cd[2];
+    two_product(a, b, ab[1], ab[0]);
+    two_product(c, d, cd[1], cd[0]);
+    cd[0] = -cd[0];
+    cd[1] = -cd[1];
+    return expansion_sum(2, ab, 2, cd, h);
+}
+
+// h = e * b * b
+int32 scale_expansion_squared(int32 elen, const double* e, double b, double* h)
+{
+    double t[96];
+    const int32 tlen = scale_expansion(elen, e, b, t);
+    return scale_expansion(tlen, t, b, h);
+}
+
+} // namespace
+
+double orient_exact(
+    const double px,
+    const double py,
+    const double qx,
+    const double qy,
+    const double rx,
+    const double ry
+    )
+{
+    double aterms[4];
+    double bterms[4];
+    double cterms[4];
+    double v[8];
+    double w[12];
+
+    const int32 alen = product_diff(px, qy, px, ry, aterms);
+    const int32 blen = product_diff(qx, ry, qx, py, bterms);
+    const int32 clen = product_diff(rx, py, rx, qy, cterms);
+
+    const int32 vlen = expansion_sum(alen, aterms, blen, bterms, v);
+    const int32 wlen = expansion_sum(vlen, v, clen, cterms, w);
+
+    return w[wlen - 1];
+}
+
+double in_circle_exact(
+    const double ax,
+    const double ay,
+    const double bx,
+    const double by,
+    const double cx,
+    const double cy,
+    const double px,
+    const double py
+    )
+{
+    double ab[4], bc[4], cd[4], da[4], ac[4], bd[4];
+    double temp[8];
+    double cda[12], dab[12], abc[12], bcd[12];
+    double adet[96], bdet[96], cdet[96], ddet[96];
+    double x[48], y[48];
+    double abdet[192], cddet[192];
+    double deter[384];
+
+    const int32 ablen = product_diff(ax, by, bx, ay, ab);
+    const int32 bclen = product_diff(bx, cy, cx, by, bc);
+    const int32 cdlen = product_diff(cx, py, px, cy, cd);
+    const int32 dalen = product_diff(px, ay, ax, py, da);
+    const int32 aclen = product_diff(ax, cy, cx, ay, ac);
+    const int32 bdlen = product_diff(bx, py, px, by, bd);
+
+    int32 templen;
+
+    templen = expansion_sum(cdlen, cd, dalen, da, temp);
+    const int32 cdalen = expansion_sum(templen, temp, aclen, ac, cda);
+
+    templen = expansion_sum(dalen, da, ablen, ab, temp);
+    const int32 dablen = expansion_sum(templen, temp, bdlen, bd, dab);
+
+    for (int32 i = 0; i < bdlen; ++i)
+    {
+        bd[i] = -bd[i];
+    }
+
+    for (int32 i = 0; i < aclen; ++i)
+    {
+        ac[i] = -ac[i];
+    }
+
+    templen = expansion_sum(ablen, ab, bclen, bc, temp);
+    const int32 abclen = expansion_sum(templen, temp, aclen, ac, abc);
+
+    templen = expansion_sum(bclen, bc, cdlen, cd, temp);
+    const int32 bcdlen = expansion_sum(templen, temp, bdlen, bd, bcd);
+
+    int32 xlen;
+    int32 ylen;
+
+    xlen = scale_expansion_squared(bcdlen, bcd, ax, x);
+    ylen = scale_expansion_squared(bcdlen, bcd, ay, y);
+    const int32 alen = expansion_sum(xlen, x, ylen, y, adet);
+
+    xlen = scale_expansion_squared(cdalen, cda, bx, x);
+    ylen = scale_expansion_squared(cdalen, cda, by, y);
+    const int32 blen = expansion_sum(xlen, x, ylen, y, bdet);
+
+    xlen = scale_expansion_squared(dablen, dab, cx, x);
+    ylen = scale_expansion_squared(dablen, dab, cy, y);
+    const int32 clen = expansion_sum(xlen, x, ylen, y, cdet);
+
+    xlen = scale_expansion_squared(abclen, abc, px, x);
+    ylen = scale_expansion_squared(abclen, abc, py, y);
+    const int32 dlen = expansion_sum(xlen, x, ylen, y, ddet);
+
+    // bdet and ddet carry negative signs
+    for (int32 i = 0; i < blen; ++i)
+    {
+        bdet[i] = -bdet[i];
+    }
+
+    for (int32 i = 0; i < dlen; ++i)
+    {
+        ddet[i] = -ddet[i];
+    }
+
+    const int32 abdetlen = expansion_sum(alen, adet, blen, bdet, abdet);
+    const int32 cddetlen = expansion_sum(clen, cdet, dlen, ddet, cddet);
+    const int32 deterlen = expansion_sum(abdetlen, abdet, cddetlen, cddet, deter);
+
+    return deter[deterlen - 1];
+}
+
+template<typename FReal, typename FIndex>
+TDelaunator<FReal, FIndex>::TDelaunator()
     : coords(),
       triangles(),
       halfedges(),
@@ -11,13 +608,34 @@ Delaunator::Delaunator()
       hull_next(),
       hull_tri(),
       hull_start(),
+      touched(),
+      hull_touched(false),
+      constrained(),
+      robust_predicates(false),
+      retain_capacity(false),
+      allocation_count(0),
+      flip_count(0),
+      hash_probe_count(0),
+      hull_step_count(0),
+      m_ids(),
       m_hash(),
       m_hash_size(),
-      m_edge_stack()
+      m_edge_stack(),
+      m_flip_stack(),
+      m_star(),
+      m_fill(),
+      m_record_touched(false),
+      m_sort_keys(),
+      m_sort_keys_tmp(),
+      m_sort_ids_tmp(),
+      m_sort_histograms(),
+      m_scan_values(),
+      m_scan_indices()
 {
 }
 
-Delaunator::Delaunator(const FReal* in_coords, FIndex in_coords_num)
+template<typename FReal, typename FIndex>
+TDelaunator<FReal, FIndex>::TDelaunator(const FReal* in_coords, FIndex in_coords_num, bool in_robust_predicates)
     : coords(in_coords, in_coords_num),
       triangles(),
       halfedges(),
@@ -25,113 +643,131 @@ Delaunator::Delaunator(const FReal* in_coords, FIndex in_coords_num)
       hull_next(),
       hull_tri(),
       hull_start(),
+      touched(),
+      hull_touched(false),
+      constrained(),
+      robust_predicates(in_robust_predicates),
+      retain_capacity(false),
+      allocation_count(0),
+      flip_count(0),
+      hash_probe_count(0),
+      hull_step_count(0),
+      m_ids(),
       m_hash(),
       m_hash_size(),
-      m_edge_stack()
+      m_edge_stack(),
+      m_flip_stack(),
+      m_star(),
+      m_fill(),
+      m_record_touched(false),
+      m_sort_keys(),
+      m_sort_keys_tmp(),
+      m_sort_ids_tmp(),
+      m_sort_histograms(),
+      m_scan_values(),
+      m_scan_indices()
 {
     update();
 }
 
-void Delaunator::update(const TArray<FVector2D>& InPoints)
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::update_parallel(FIndex slab_count)
 {
-    if (InPoints.Num() >= 3)
+    const FIndex n = coords.Num() >> 1;
+
+    constrained.Empty();
+
+    if (slab_count <= 0)
     {
-        coords = MakeArrayView(
-            reinterpret_cast<const float*>(InPoints.GetData()),
-            InPoints.Num()*2
-            );
+        slab_count = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+    }
 
+    slab_count = FMath::Min(slab_count, n / PARALLEL_MIN_SLAB_SIZE);
+
+    // fallback to serial sweep on small or degenerate input
+    if (slab_count < 2 || ! update_slabs(slab_count))
+    {
         update();
     }
 }
 
-void Delaunator::update()
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::reset_triangulation()
+{
+    triangles.Reset();
+    halfedges.Reset();
+    touched.Reset();
+    hull_start = INVALID_INDEX;
+    hull_size = 0;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::update()
 {
     FIndex n = coords.Num() >> 1;
 
-    FReal max_x = TNumericLimits<FReal>::Min();
-    FReal max_y = TNumericLimits<FReal>::Min();
-    FReal min_x = TNumericLimits<FReal>::Max();
-    FReal min_y = TNumericLimits<FReal>::Max();
+    checkf(fits(n), TEXT("Point count exceeds the triangulation index range, use int64 indices"));
 
-    TArray<FIndex> ids;
-    ids.SetNumUninitialized(n);
+    constrained.Empty();
 
-    for (FIndex i=0; i<n; ++i)
+    if (n < 3)
     {
-        const FReal x = coords[2 * i];
-        const FReal y = coords[2 * i + 1];
+        reset_triangulation();
+        return;
+    }
 
-        if (x < min_x) min_x = x;
-        if (y < min_y) min_y = y;
-        if (x > max_x) max_x = x;
-        if (y > max_y) max_y = y;
+    TIndexArray<FIndex>& ids(m_ids);
+    reserve_workspace(ids, n);
+
+    const FReal* xy = coords.GetData();
+
+    FReal min_x;
+    FReal min_y;
+    FReal max_x;
+    FReal max_y;
+
+    scan_bounds_chunks(n, min_x, min_y, max_x, max_y);
 
-        ids[i] = i;
-    }
     const FReal cx = (min_x + max_x) / 2;
     const FReal cy = (min_y + max_y) / 2;
-    FReal min_dist = TNumericLimits<FReal>::Max();
-
-    FIndex i0 = INVALID_INDEX;
-    FIndex i1 = INVALID_INDEX;
-    FIndex i2 = INVALID_INDEX;
+    FReal min_dist;
+    FReal min_radius;
 
     // pick a seed point close to the centroid
 
-    for (FIndex i = 0; i < n; i++)
+    FIndex i0 = scan_min_chunks(n, min_dist, [=](FIndex begin, FIndex end, FReal& best, FIndex& best_index)
     {
-        const FReal d = dist(cx, cy, coords[2 * i], coords[2 * i + 1]);
-
-        if (d < min_dist)
-        {
-            i0 = i;
-            min_dist = d;
-        }
-    }
+        scan_nearest(xy, begin, end, cx, cy, false, best, best_index);
+    } );
 
     const FReal i0x = coords[2 * i0];
     const FReal i0y = coords[2 * i0 + 1];
 
-    min_dist = TNumericLimits<FReal>::Max();
-
     // find the point closest to the seed
 
-    for (FIndex i = 0; i < n; i++)
+    FIndex i1 = scan_min_chunks(n, min_dist, [=](FIndex begin, FIndex end, FReal& best, FIndex& best_index)
     {
-        if (i == i0) continue;
-        const FReal d = dist(i0x, i0y, coords[2 * i], coords[2 * i + 1]);
-        if (d < min_dist && d > 0.0)
-        {
-            i1 = i;
-            min_dist = d;
-        }
-    }
+        scan_nearest(xy, begin, end, i0x, i0y, true, best, best_index);
+    } );
 
     FReal i1x = coords[2 * i1];
     FReal i1y = coords[2 * i1 + 1];
 
-    FReal min_radius = TNumericLimits<FReal>::Max();
-
     // find the third point which forms
     // the smallest circumcircle with the first two
 
-    for (FIndex i = 0; i < n; i++)
+    FIndex i2 = scan_min_chunks(n, min_radius, [=](FIndex begin, FIndex end, FReal& best, FIndex& best_index)
     {
-        if (i == i0 || i == i1) continue;
+        scan_circumradius(xy, begin, end, i0, i1, i0x, i0y, i1x, i1y, best, best_index);
+    } );
 
-        const FReal r = circumradius(
-            i0x, i0y, i1x, i1y, coords[2 * i], coords[2 * i + 1]);
-
-        if (r < min_radius)
-        {
-            i2 = i;
-            min_radius = r;
-        }
+    // collinear or coincident points, no triangulation exists
+    if (! (min_radius < TNumericLimits<FReal>::Max()))
+    {
+        reset_triangulation();
+        return;
     }
 
-    check(min_radius < TNumericLimits<FReal>::Max());
-
     FReal i2x = coords[2 * i2];
     FReal i2y = coords[2 * i2 + 1];
 
@@ -147,17 +783,17 @@ void Delaunator::update()
 
     circumcenter(m_centerx, m_centery, i0x, i0y, i1x, i1y, i2x, i2y);
 
-    ids.Sort(compare(coords, m_centerx, m_centery));
+    sort_ids(ids);
 
     // initialize a hash table for storing edges of the advancing convex hull
-    m_hash_size = FMath::CeilToInt(FMath::Sqrt(n));
-    m_hash.SetNumUninitialized(m_hash_size);
+    m_hash_size = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(n)));
+    reserve_workspace(m_hash, m_hash_size);
     FMemory::Memset(m_hash.GetData(), ~0, m_hash_size*m_hash.GetTypeSize());
 
     // initialize arrays for tracking the edges of the advancing convex hull
-    hull_prev.SetNumUninitialized(n);
-    hull_next.SetNumUninitialized(n);
-    hull_tri.SetNumUninitialized(n);
+    reserve_workspace(hull_prev, n);
+    reserve_workspace(hull_next, n);
+    reserve_workspace(hull_tri, n);
 
     // set up the seed triangle as the starting hull
 
@@ -177,14 +813,17 @@ void Delaunator::update()
     m_hash[hash_key(i2x, i2y)] = i2;
 
     FIndex max_triangles = n < 3 ? 1 : 2 * n - 5;
-    triangles.Reset(max_triangles * 3);
-    halfedges.Reset(max_triangles * 3);
+    reserve_workspace(triangles, max_triangles * 3, true);
+    reserve_workspace(halfedges, max_triangles * 3, true);
 
     add_triangle(i0, i1, i2, INVALID_INDEX, INVALID_INDEX, INVALID_INDEX);
 
     FReal xp = BIG_NUMBER; // = std::numeric_limits<FReal>::quiet_NaN();
     FReal yp = BIG_NUMBER; // = std::numeric_limits<FReal>::quiet_NaN();
 
+    uint32 hash_probes = 0;
+    uint32 hull_steps = 0;
+
     for (FIndex k = 0; k < n; k++)
     {
         const FIndex i = ids[k];
@@ -215,6 +854,7 @@ void Delaunator::update()
 
         for (FIndex j = 0; j < m_hash_size; j++)
         {
+            ++hash_probes;
             start = m_hash[fast_mod(key + j, m_hash_size)];
 
             if (start != INVALID_INDEX && start != hull_next[start])
@@ -231,6 +871,7 @@ void Delaunator::update()
             q = hull_next[e],
             !orient(x, y, coords[2 * e], coords[2 * e + 1], coords[2 * q], coords[2 * q + 1]))
         {
+            ++hull_steps;
             e = q;
 
             if (e == start)
@@ -265,6 +906,7 @@ void Delaunator::update()
             q = hull_next[next],
             orient(x, y, coords[2 * next], coords[2 * next + 1], coords[2 * q], coords[2 * q + 1]))
         {
+            ++hull_steps;
             t = add_triangle(next, i, q, hull_tri[i], INVALID_INDEX, hull_tri[next]);
             hull_tri[i] = legalize(t + 2);
             hull_next[next] = next; // mark as removed
@@ -280,6 +922,7 @@ void Delaunator::update()
                 q = hull_prev[e],
                 orient(x, y, coords[2 * q], coords[2 * q + 1], coords[2 * e], coords[2 * e + 1]))
             {
+                ++hull_steps;
                 t = add_triangle(q, i, e, INVALID_INDEX, hull_tri[e], hull_tri[q]);
                 legalize(t + 2);
                 hull_tri[q] = t;
@@ -300,16 +943,232 @@ void Delaunator::update()
         m_hash[hash_key(coords[2 * e], coords[2 * e + 1])] = e;
     }
 
-    // trim allocation sizes
-    triangles.Shrink();
-    halfedges.Shrink();
+    hash_probe_count += hash_probes;
+    hull_step_count += hull_steps;
+
+    // trim allocation sizes unless kept for the next update
+    if (! retain_capacity)
+    {
+        triangles.Shrink();
+        halfedges.Shrink();
+    }
 }
 
-FIndex Delaunator::legalize(FIndex a)
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::scan_bounds_chunks(FIndex n, FReal& min_x, FReal& min_y, FReal& max_x, FReal& max_y)
 {
-    FIndex i = 0;
-    FIndex ar = 0;
-    m_edge_stack.Reset();
+    const FIndex chunk_count = get_scan_chunk_count(n);
+
+    reserve_workspace(m_scan_values, chunk_count * 4);
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        FReal* bounds = m_scan_values.GetData() + c * 4;
+        bounds[0] = TNumericLimits<FReal>::Max();
+        bounds[1] = TNumericLimits<FReal>::Max();
+        bounds[2] = TNumericLimits<FReal>::Lowest();
+        bounds[3] = TNumericLimits<FReal>::Lowest();
+
+        scan_bounds(
+            coords.GetData(),
+            get_chunk_start(n, chunk_count, c),
+            get_chunk_start(n, chunk_count, c + 1),
+            bounds);
+    },
+    chunk_count < 2);
+
+    min_x = m_scan_values[0];
+    min_y = m_scan_values[1];
+    max_x = m_scan_values[2];
+    max_y = m_scan_values[3];
+
+    for (FIndex c = 1; c < chunk_count; ++c)
+    {
+        min_x = FMath::Min(min_x, m_scan_values[c * 4]);
+        min_y = FMath::Min(min_y, m_scan_values[c * 4 + 1]);
+        max_x = FMath::Max(max_x, m_scan_values[c * 4 + 2]);
+        max_y = FMath::Max(max_y, m_scan_values[c * 4 + 3]);
+    }
+}
+
+template<typename FReal, typename FIndex>
+template<typename FScan>
+FIndex TDelaunator<FReal, FIndex>::scan_min_chunks(FIndex n, FReal& out_min, FScan scan)
+{
+    const FIndex chunk_count = get_scan_chunk_count(n);
+
+    reserve_workspace(m_scan_values, chunk_count);
+    reserve_workspace(m_scan_indices, chunk_count);
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        m_scan_values[c] = TNumericLimits<FReal>::Max();
+        m_scan_indices[c] = INVALID_INDEX;
+
+        scan(
+            get_chunk_start(n, chunk_count, c),
+            get_chunk_start(n, chunk_count, c + 1),
+            m_scan_values[c],
+            m_scan_indices[c]);
+    },
+    chunk_count < 2);
+
+    // first lowest chunk result, same pick as a serial scan
+    FIndex min_index = m_scan_indices[0];
+    out_min = m_scan_values[0];
+
+    for (FIndex c = 1; c < chunk_count; ++c)
+    {
+        if (m_scan_values[c] < out_min)
+        {
+            out_min = m_scan_values[c];
+            min_index = m_scan_indices[c];
+        }
+    }
+
+    return min_index;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::sort_ids(TIndexArray<FIndex>& ids)
+{
+    // lsd radix sort on the squared distance bits from the seed circumcenter,
+    // same order as the compare functor
+
+    constexpr int32 KEY_BITS = sizeof(FSortKey) * 8;
+    constexpr int32 PASS_COUNT = (KEY_BITS + SORT_RADIX_BITS - 1) / SORT_RADIX_BITS;
+    constexpr uint32 RADIX_SIZE = 1u << SORT_RADIX_BITS;
+    constexpr uint32 RADIX_MASK = RADIX_SIZE - 1;
+    constexpr FSortKey SIGN_BIT = FSortKey(1) << (KEY_BITS - 1);
+
+    const FIndex n = ids.Num();
+
+    reserve_workspace(m_sort_keys, n);
+    reserve_workspace(m_sort_keys_tmp, n);
+    reserve_workspace(m_sort_ids_tmp, n);
+
+    // distance keys and digit histograms per chunk, ids start in point order
+
+    const FIndex chunk_count = get_scan_chunk_count(n);
+    const int32 histogram_size = PASS_COUNT * RADIX_SIZE;
+
+    reserve_workspace(m_sort_histograms, chunk_count * histogram_size);
+    FMemory::Memzero(m_sort_histograms.GetData(), m_sort_histograms.Num() * m_sort_histograms.GetTypeSize());
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        uint32* chunk_histogram = m_sort_histograms.GetData() + c * histogram_size;
+        const FIndex begin = get_chunk_start(n, chunk_count, c);
+        const FIndex end = get_chunk_start(n, chunk_count, c + 1);
+
+        FReal dists[SCAN_BLOCK_SIZE];
+
+        for (FIndex block = begin; block < end; block += SCAN_BLOCK_SIZE)
+        {
+            const FIndex block_end = FMath::Min(block + SCAN_BLOCK_SIZE, end);
+
+            scan_dists(coords.GetData(), block, block_end, m_centerx, m_centery, dists);
+
+            for (FIndex i = block; i < block_end; ++i)
+            {
+                // flip float bits so unsigned order matches float order
+                FSortKey key;
+                FMemory::Memcpy(&key, &dists[i - block], sizeof(key));
+                key = (key & SIGN_BIT) ? ~key : (key | SIGN_BIT);
+
+                m_sort_keys[i] = key;
+                ids[i] = i;
+
+                for (int32 pass = 0; pass < PASS_COUNT; ++pass)
+                {
+                    ++chunk_histogram[pass * RADIX_SIZE + ((key >> (pass * SORT_RADIX_BITS)) & RADIX_MASK)];
+                }
+            }
+        }
+    },
+    chunk_count < 2);
+
+    uint32 histogram[PASS_COUNT][RADIX_SIZE];
+    FMemory::Memcpy(histogram, m_sort_histograms.GetData(), sizeof(histogram));
+
+    for (FIndex c = 1; c < chunk_count; ++c)
+    {
+        const uint32* chunk_histogram = m_sort_histograms.GetData() + c * histogram_size;
+
+        for (int32 d = 0; d < histogram_size; ++d)
+        {
+            histogram[d / RADIX_SIZE][d % RADIX_SIZE] += chunk_histogram[d];
+        }
+    }
+
+    for (int32 pass = 0; pass < PASS_COUNT; ++pass)
+    {
+        const int32 shift = pass * SORT_RADIX_BITS;
+        uint32* counts = histogram[pass];
+
+        // all keys share the digit, skip pass
+        if (n == 0 || counts[(m_sort_keys[0] >> shift) & RADIX_MASK] == uint32(n))
+        {
+            continue;
+        }
+
+        uint32 offset = 0;
+
+        for (uint32 d = 0; d < RADIX_SIZE; ++d)
+        {
+            const uint32 count = counts[d];
+            counts[d] = offset;
+            offset += count;
+        }
+
+        for (FIndex i = 0; i < n; ++i)
+        {
+            const FSortKey key = m_sort_keys[i];
+            const uint32 pos = counts[(key >> shift) & RADIX_MASK]++;
+            m_sort_keys_tmp[pos] = key;
+            m_sort_ids_tmp[pos] = ids[i];
+        }
+
+        Swap(m_sort_keys, m_sort_keys_tmp);
+        Swap(ids, m_sort_ids_tmp);
+    }
+
+    // break distance ties on x, then y
+
+    auto tie_compare = [this](FIndex i, FIndex j)
+    {
+        const FReal diff_x = coords[2 * i] - coords[2 * j];
+
+        if (diff_x > 0.0 || diff_x < 0.0)
+        {
+            return diff_x < 0;
+        }
+
+        return coords[2 * i + 1] < coords[2 * j + 1];
+    };
+
+    FIndex run = 0;
+
+    for (FIndex i = 1; i <= n; ++i)
+    {
+        if (i == n || m_sort_keys[i] != m_sort_keys[run])
+        {
+            if (i - run > 1)
+            {
+                Sort(ids.GetData() + run, i - run, tie_compare);
+            }
+
+            run = i;
+        }
+    }
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::legalize(FIndex a)
+{
+    FIndex i = 0;
+    FIndex ar = 0;
+    m_edge_stack.Reset();
 
     // recursion eliminated with a fixed-size stack
     while (true)
@@ -358,7 +1217,8 @@ FIndex Delaunator::legalize(FIndex a)
         const FIndex pl = triangles[al];
         const FIndex p1 = triangles[bl];
 
-        const bool illegal = in_circle(
+        // constrained edges are never flipped
+        const bool illegal = ! is_constrained(a) && in_circle(
             coords[2 * p0],
             coords[2 * p0 + 1],
             coords[2 * pr],
@@ -370,25 +1230,28 @@ FIndex Delaunator::legalize(FIndex a)
 
         if (illegal)
         {
+            ++flip_count;
+
             triangles[a] = p1;
             triangles[b] = p0;
 
+            move_constrained(bl, a);
+            move_constrained(ar, b);
+
+            if (m_record_touched)
+            {
+                touched.Emplace(a / 3);
+                touched.Emplace(b / 3);
+            }
+
             auto hbl = halfedges[bl];
 
             // edge swapped on the other side of the hull (rare);
-            // fix the halfedge reference
-            if (hbl == INVALID_INDEX)
+            // fix the halfedge reference, hull halfedges start at their
+            // hull point so the reference is found without a hull walk
+            if (hbl == INVALID_INDEX && hull_tri[p1] == bl)
             {
-                FIndex e = hull_start;
-                do
-                {
-                    if (hull_tri[e] == bl)
-                    {
-                        hull_tri[e] = a;
-                        break;
-                    }
-                    e = hull_prev[e];
-                } while (e != hull_start);
+                hull_tri[p1] = a;
             }
 
             link(a, hbl);
@@ -402,6 +1265,10 @@ FIndex Delaunator::legalize(FIndex a)
             }
             else
             {
+                if (m_edge_stack.Num() == m_edge_stack.Max())
+                {
+                    ++allocation_count;
+                }
                 m_edge_stack.Emplace(br);
             }
             i++;
@@ -424,4 +1291,2243 @@ FIndex Delaunator::legalize(FIndex a)
     return ar;
 }
 
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::insert(FIndex i, FIndex start)
+{
+    const FIndex n = coords.Num() >> 1;
+    const FReal x = coords[2 * i];
+    const FReal y = coords[2 * i + 1];
+
+    touched.Reset();
+    hull_touched = false;
+
+    if (hull_next.Num() < n)
+    {
+        hull_prev.SetNumUninitialized(n);
+        hull_next.SetNumUninitialized(n);
+        hull_tri.SetNumUninitialized(n);
+    }
+
+    if (start < 0 || start >= triangles.Num() / 3)
+    {
+        start = 0;
+    }
+
+    bool bOutside;
+    const FIndex e = locate(x, y, start, bOutside);
+    const FIndex t = e / 3;
+
+    // skip near-duplicate points
+
+    for (FIndex j = 0; j < 3; ++j)
+    {
+        const FIndex p = triangles[3 * t + j];
+
+        if (check_pts_equal(x, y, coords[2 * p], coords[2 * p + 1]))
+        {
+            return INVALID_INDEX;
+        }
+    }
+
+    FIndex result;
+    m_record_touched = true;
+
+    if (bOutside)
+    {
+        result = insert_hull(i, triangles[e]);
+    }
+    else
+    {
+        result = INVALID_INDEX;
+
+        // point on a triangle edge, split the edge instead
+
+        for (FIndex j = 0; j < 3; ++j)
+        {
+            const FIndex se = 3 * t + j;
+            const FIndex a = triangles[se];
+            const FIndex b = triangles[next_halfedge(se)];
+            const FReal ax = coords[2 * a];
+            const FReal ay = coords[2 * a + 1];
+            const FReal bx = coords[2 * b];
+            const FReal by = coords[2 * b + 1];
+
+            if (! orient(x, y, ax, ay, bx, by) && ! orient(x, y, bx, by, ax, ay))
+            {
+                result = split_edge(i, se);
+                break;
+            }
+        }
+
+        if (result == INVALID_INDEX)
+        {
+            result = split_triangle(i, t);
+        }
+    }
+
+    m_record_touched = false;
+
+    return result;
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::locate(FReal x, FReal y, FIndex start, bool& out_outside) const
+{
+    const FIndex tri_count = triangles.Num() / 3;
+
+    FIndex t = start;
+    FIndex r = 0;
+
+    // visibility walk, rotate the first tested edge to avoid cycles
+    for (FIndex step = 0; step < tri_count; ++step)
+    {
+        FIndex j = 0;
+
+        for (; j < 3; ++j)
+        {
+            const FIndex e = 3 * t + (j + r) % 3;
+            const FIndex a = triangles[e];
+            const FIndex b = triangles[next_halfedge(e)];
+
+            if (orient(x, y, coords[2 * a], coords[2 * a + 1], coords[2 * b], coords[2 * b + 1]))
+            {
+                if (halfedges[e] == INVALID_INDEX)
+                {
+                    out_outside = true;
+                    return e;
+                }
+
+                t = halfedges[e] / 3;
+                break;
+            }
+        }
+
+        if (j == 3)
+        {
+            out_outside = false;
+            return 3 * t;
+        }
+
+        r = (r + 1) % 3;
+    }
+
+    // walk failed to converge, scan all triangles
+
+    for (t = 0; t < tri_count; ++t)
+    {
+        FIndex j = 0;
+
+        for (; j < 3; ++j)
+        {
+            const FIndex a = triangles[3 * t + j];
+            const FIndex b = triangles[next_halfedge(3 * t + j)];
+
+            if (orient(x, y, coords[2 * a], coords[2 * a + 1], coords[2 * b], coords[2 * b + 1]))
+            {
+                break;
+            }
+        }
+
+        if (j == 3)
+        {
+            out_outside = false;
+            return 3 * t;
+        }
+    }
+
+    out_outside = true;
+
+    FIndex e = hull_start;
+    do
+    {
+        const FIndex q = hull_next[e];
+
+        if (orient(x, y, coords[2 * e], coords[2 * e + 1], coords[2 * q], coords[2 * q + 1]))
+        {
+            break;
+        }
+
+        e = q;
+    }
+    while (e != hull_start);
+
+    return hull_tri[e];
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::insert_hull(FIndex i, FIndex e)
+{
+    const FReal x = coords[2 * i];
+    const FReal y = coords[2 * i + 1];
+
+    FIndex q;
+
+    // walk back to the first visible hull edge
+
+    for (FIndex k = 0; k < hull_size; ++k)
+    {
+        q = hull_prev[e];
+
+        if (! orient(x, y, coords[2 * q], coords[2 * q + 1], coords[2 * e], coords[2 * e + 1]))
+        {
+            break;
+        }
+
+        ++hull_step_count;
+        e = q;
+    }
+
+    // add the first triangle from the point
+    FIndex t = add_triangle(
+        e,
+        i,
+        hull_next[e],
+        INVALID_INDEX,
+        INVALID_INDEX,
+        hull_tri[e]);
+
+    if (constrained.Num() > 0)
+    {
+        constrained[t + 2] = is_constrained(halfedges[t + 2]);
+    }
+
+    touched.Emplace(t / 3);
+
+    const FIndex result = t;
+
+    hull_tri[i] = legalize(t + 2);
+    hull_tri[e] = t;
+    hull_size++;
+
+    // walk forward through the hull,
+    // adding more triangles and flipping recursively
+    FIndex next = hull_next[e];
+    while (
+        q = hull_next[next],
+        orient(x, y, coords[2 * next], coords[2 * next + 1], coords[2 * q], coords[2 * q + 1]))
+    {
+        t = add_triangle(next, i, q, hull_tri[i], INVALID_INDEX, hull_tri[next]);
+
+        if (constrained.Num() > 0)
+        {
+            constrained[t + 2] = is_constrained(halfedges[t + 2]);
+        }
+
+        ++hull_step_count;
+        touched.Emplace(t / 3);
+        hull_tri[i] = legalize(t + 2);
+        hull_next[next] = next; // mark as removed
+        hull_size--;
+        next = q;
+    }
+
+    // update the hull indices
+    hull_prev[i] = e;
+    hull_start = e;
+    hull_prev[next] = i;
+    hull_next[e] = i;
+    hull_next[i] = next;
+
+    hull_touched = true;
+
+    return result;
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::split_triangle(FIndex i, FIndex t)
+{
+    /* split [a, b, c] into [a, b, i], [b, c, i] and [c, a, i],
+     * the first one reuses the original triangle slot
+     */
+    const FIndex e0 = 3 * t;
+    const FIndex e1 = e0 + 1;
+    const FIndex e2 = e0 + 2;
+
+    const FIndex b = triangles[e1];
+    const FIndex c = triangles[e2];
+    const FIndex a = triangles[e0];
+    const FIndex h1 = halfedges[e1];
+    const FIndex h2 = halfedges[e2];
+
+    triangles[e2] = i;
+
+    const FIndex t1 = add_triangle(b, c, i, h1, INVALID_INDEX, e1);
+    const FIndex t2 = add_triangle(c, a, i, h2, e2, t1 + 1);
+
+    move_constrained(e1, t1);
+    move_constrained(e2, t2);
+
+    if (h1 == INVALID_INDEX)
+    {
+        hull_tri[b] = t1;
+    }
+
+    if (h2 == INVALID_INDEX)
+    {
+        hull_tri[c] = t2;
+    }
+
+    touched.Emplace(t);
+    touched.Emplace(t1 / 3);
+    touched.Emplace(t2 / 3);
+
+    legalize(e0);
+    legalize(t1);
+    legalize(t2);
+
+    return t1 + 2;
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::split_edge(FIndex i, FIndex e)
+{
+    /* split edge [a, b] of triangles [a, b, c] and [b, a, d],
+     * the original slots become [a, i, c] and [b, i, d]
+     *
+     *           c                     c
+     *          / \                   /|\
+     *         /   \                 / | \
+     *       a/__e__\b     =>      a/__i__\b
+     *        \  o  /                \  |  /
+     *         \   /                  \ | /
+     *          \ /                    \|/
+     *           d                     d
+     */
+    const FIndex o = halfedges[e];
+    const FIndex en = next_halfedge(e);
+
+    const FIndex a = triangles[e];
+    const FIndex b = triangles[en];
+    const FIndex c = triangles[prev_halfedge(e)];
+    const FIndex h_bc = halfedges[en];
+
+    triangles[en] = i;
+
+    const FIndex t1 = add_triangle(i, b, c, INVALID_INDEX, h_bc, en);
+
+    // split constrained edge keeps the constraint on both halves
+    if (constrained.Num() > 0)
+    {
+        constrained[t1] = is_constrained(e);
+    }
+
+    move_constrained(en, t1 + 1);
+
+    if (h_bc == INVALID_INDEX)
+    {
+        hull_tri[b] = t1 + 1;
+    }
+
+    touched.Emplace(e / 3);
+    touched.Emplace(t1 / 3);
+
+    if (o != INVALID_INDEX)
+    {
+        const FIndex on = next_halfedge(o);
+        const FIndex d = triangles[prev_halfedge(o)];
+        const FIndex h_ad = halfedges[on];
+
+        triangles[on] = i;
+
+        const FIndex t2 = add_triangle(i, a, d, e, h_ad, on);
+        link(t1, o);
+
+        if (constrained.Num() > 0)
+        {
+            constrained[t2] = is_constrained(o);
+        }
+
+        move_constrained(on, t2 + 1);
+
+        if (h_ad == INVALID_INDEX)
+        {
+            hull_tri[a] = t2 + 1;
+        }
+
+        touched.Emplace(o / 3);
+        touched.Emplace(t2 / 3);
+
+        legalize(prev_halfedge(e));
+        legalize(t1 + 1);
+        legalize(prev_halfedge(o));
+        legalize(t2 + 1);
+    }
+    else
+    {
+        // hull edge, insert the point into the hull
+        hull_next[a] = i;
+        hull_prev[i] = a;
+        hull_next[i] = b;
+        hull_prev[b] = i;
+        hull_tri[a] = e;
+        hull_size++;
+        hull_touched = true;
+
+        legalize(prev_halfedge(e));
+        hull_tri[i] = legalize(t1 + 1);
+    }
+
+    return t1 + 2;
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::remove(FIndex i, FIndex e)
+{
+    touched.Reset();
+    hull_touched = false;
+
+    // collect outgoing halfedges around the point,
+    // hull points start from the outgoing hull edge
+
+    const bool bHull = gather_star(i, e);
+    const TIndexArray<FIndex>& star(m_star);
+
+    const FIndex star_count = star.Num();
+    const FIndex vertex_count = bHull ? star_count + 1 : star_count;
+
+    // link polygon vertices and the outer halfedge of each polygon edge
+
+    TIndexArray<FIndex> poly_v;
+    TIndexArray<FIndex> poly_h;
+    poly_v.SetNumUninitialized(vertex_count);
+    poly_h.SetNumUninitialized(vertex_count);
+
+    // constrained hull edges of the polygon, restored by origin point
+    TIndexArray<FIndex> hull_constraints;
+
+    for (FIndex q = 0; q < star_count; ++q)
+    {
+        const FIndex le = next_halfedge(star[q]);
+
+        poly_v[q] = triangles[le];
+        poly_h[q] = halfedges[le];
+
+        if (poly_h[q] == INVALID_INDEX && is_constrained(le))
+        {
+            hull_constraints.Emplace(poly_v[q]);
+        }
+    }
+
+    if (bHull)
+    {
+        poly_v[star_count] = triangles[prev_halfedge(star[star_count - 1])];
+        poly_h[star_count] = INVALID_INDEX;
+    }
+
+    auto coord_orient = [&](FIndex p, FIndex q, FIndex r)
+    {
+        return orient(
+            coords[2 * p], coords[2 * p + 1],
+            coords[2 * q], coords[2 * q + 1],
+            coords[2 * r], coords[2 * r + 1]);
+    };
+
+    // plan fill triangles as [x, y, z, hxy, hyz, hzx],
+    // each fill triangle takes the next star slot
+
+    TIndexArray<FIndex>& fill(m_fill);
+    fill.Reset();
+
+    FIndex fill_count = 0;
+
+    TIndexArray<FIndex> stack_v;
+    TIndexArray<FIndex> stack_h;
+
+    if (bHull)
+    {
+        // fill concave pockets between the link chain and its convex hull
+        stack_v.Emplace(poly_v[0]);
+
+        for (FIndex j = 1; j < vertex_count; ++j)
+        {
+            const FIndex z = poly_v[j];
+            FIndex h = poly_h[j - 1];
+
+            while (stack_v.Num() >= 2 && coord_orient(stack_v.Last(1), z, stack_v.Last()))
+            {
+                fill.Append({ stack_v.Last(1), stack_v.Last(), z, stack_h.Last(), h, INVALID_INDEX });
+                h = 3 * (star[fill_count++] / 3) + 2;
+                stack_v.Pop(false);
+                stack_h.Pop(false);
+            }
+
+            stack_v.Emplace(z);
+            stack_h.Emplace(h);
+        }
+
+        // new hull edges need a triangle on the inner side
+        for (FIndex h : stack_h)
+        {
+            if (h == INVALID_INDEX)
+            {
+                return false;
+            }
+        }
+    }
+    else
+    if (! clip_polygon(poly_v, poly_h, star, fill_count))
+    {
+        return false;
+    }
+
+    if (triangles.Num() / 3 - star_count + fill_count < 1)
+    {
+        return false;
+    }
+
+    // write fill triangles into star slots
+
+    m_record_touched = true;
+    m_flip_stack.Reset();
+
+    write_fill(star, 0, fill_count, ! bHull);
+
+    if (bHull)
+    {
+        // link chain convex hull replaces the removed hull point
+
+        for (FIndex k = stack_v.Num() - 1; k > 0; --k)
+        {
+            const FIndex a = stack_v[k];
+            const FIndex b = stack_v[k - 1];
+            const FIndex h = stack_h[k - 1];
+
+            halfedges[h] = INVALID_INDEX;
+            hull_tri[a] = h;
+            hull_next[a] = b;
+            hull_prev[b] = a;
+
+            touched.Emplace(h / 3);
+        }
+
+        if (hull_start == i)
+        {
+            hull_start = stack_v[0];
+        }
+
+        hull_size += stack_v.Num() - 3;
+        hull_touched = true;
+    }
+
+    for (FIndex p : hull_constraints)
+    {
+        constrained[hull_tri[p]] = true;
+    }
+
+    flip_edges();
+
+    m_record_touched = false;
+
+    // compact unused star slots, moving the last triangles into them
+
+    TIndexArray<FIndex> free_slots;
+
+    for (FIndex q = fill_count; q < star_count; ++q)
+    {
+        free_slots.Emplace(star[q] / 3);
+    }
+
+    free_slots.Sort(TGreater<FIndex>());
+
+    FIndex tri_count = triangles.Num() / 3;
+
+    for (FIndex t : free_slots)
+    {
+        --tri_count;
+
+        if (t != tri_count)
+        {
+            move_triangle(tri_count, t);
+            touched.Emplace(t);
+        }
+    }
+
+    triangles.SetNum(tri_count * 3, false);
+    halfedges.SetNum(tri_count * 3, false);
+
+    if (constrained.Num() > 0)
+    {
+        constrained.RemoveAt(tri_count * 3, constrained.Num() - tri_count * 3);
+    }
+
+    touched.RemoveAllSwap([tri_count](FIndex t) { return t >= tri_count; });
+
+    return true;
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::gather_star(FIndex i, FIndex e)
+{
+    TIndexArray<FIndex>& star(m_star);
+    star.Reset();
+
+    const FIndex start = next_halfedge(e);
+    FIndex se = start;
+    do
+    {
+        star.Emplace(se);
+        se = halfedges[prev_halfedge(se)];
+
+        if (se == INVALID_INDEX)
+        {
+            // hull point, restart from the outgoing hull edge
+            star.Reset();
+
+            for (se = hull_tri[i]; se != INVALID_INDEX; se = halfedges[prev_halfedge(se)])
+            {
+                star.Emplace(se);
+            }
+
+            return true;
+        }
+    }
+    while (se != start);
+
+    return false;
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::clip_polygon(
+    const TIndexArray<FIndex>& poly_v,
+    TIndexArray<FIndex>& poly_h,
+    const TIndexArray<FIndex>& slots,
+    FIndex& fill_count
+    )
+{
+    const FIndex vertex_count = poly_v.Num();
+
+    auto coord_orient = [&](FIndex p, FIndex q, FIndex r)
+    {
+        return orient(
+            coords[2 * p], coords[2 * p + 1],
+            coords[2 * q], coords[2 * q + 1],
+            coords[2 * r], coords[2 * r + 1]);
+    };
+
+    // clip polygon ears, prefer ears with empty circumcircle
+    TIndexArray<FIndex> poly_next;
+    TIndexArray<FIndex> poly_prev;
+    poly_next.SetNumUninitialized(vertex_count);
+    poly_prev.SetNumUninitialized(vertex_count);
+
+    for (FIndex j = 0; j < vertex_count; ++j)
+    {
+        poly_next[j] = (j + 1) % vertex_count;
+        poly_prev[j] = (j + vertex_count - 1) % vertex_count;
+    }
+
+    FIndex live_count = vertex_count;
+    FIndex j0 = 0;
+
+    while (live_count > 3)
+    {
+        FIndex ear = INVALID_INDEX;
+        FIndex ear_rank = 0;
+
+        FIndex j = j0;
+        do
+        {
+            const FIndex x = poly_v[poly_prev[j]];
+            const FIndex y = poly_v[j];
+            const FIndex z = poly_v[poly_next[j]];
+
+            FIndex rank = 0;
+
+            if (coord_orient(x, z, y))
+            {
+                bool bEmpty = true;
+                bool bDelaunay = true;
+
+                for (FIndex w = poly_next[poly_next[j]]; w != poly_prev[j]; w = poly_next[w])
+                {
+                    const FIndex p = poly_v[w];
+
+                    // the far side of a slit repeats an ear vertex
+                    if (p == x || p == y || p == z)
+                    {
+                        continue;
+                    }
+
+                    if (! coord_orient(p, x, y) && ! coord_orient(p, y, z) && ! coord_orient(p, z, x))
+                    {
+                        bEmpty = false;
+                        break;
+                    }
+
+                    if (bDelaunay && in_circle(
+                        coords[2 * x], coords[2 * x + 1],
+                        coords[2 * y], coords[2 * y + 1],
+                        coords[2 * z], coords[2 * z + 1],
+                        coords[2 * p], coords[2 * p + 1]))
+                    {
+                        bDelaunay = false;
+                    }
+                }
+
+                rank = bEmpty ? (bDelaunay ? 3 : 2) : 1;
+            }
+
+            if (rank > ear_rank)
+            {
+                ear = j;
+                ear_rank = rank;
+
+                if (rank == 3)
+                {
+                    break;
+                }
+            }
+
+            j = poly_next[j];
+        }
+        while (j != j0);
+
+        if (ear == INVALID_INDEX)
+        {
+            return false;
+        }
+
+        const FIndex prev = poly_prev[ear];
+        const FIndex next = poly_next[ear];
+
+        m_fill.Append({ poly_v[prev], poly_v[ear], poly_v[next], poly_h[prev], poly_h[ear], INVALID_INDEX });
+        poly_h[prev] = 3 * (slots[fill_count++] / 3) + 2;
+
+        poly_next[prev] = next;
+        poly_prev[next] = prev;
+        j0 = next;
+        --live_count;
+    }
+
+    const FIndex a = j0;
+    const FIndex b = poly_next[a];
+    const FIndex c = poly_next[b];
+
+    m_fill.Append({ poly_v[a], poly_v[b], poly_v[c], poly_h[a], poly_h[b], poly_h[c] });
+    ++fill_count;
+
+    return true;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::write_fill(const TIndexArray<FIndex>& slots, FIndex first, FIndex count, bool closed)
+{
+    for (FIndex q = first; q < first + count; ++q)
+    {
+        const FIndex t = 3 * (slots[q] / 3);
+        const FIndex* f = m_fill.GetData() + 6 * q;
+
+        // the last triangle of a closed polygon links all edges,
+        // otherwise [z, x] is linked by a later triangle or the hull
+        const FIndex edge_count = (closed && q == first + count - 1) ? 3 : 2;
+
+        triangles[t] = f[0];
+        triangles[t + 1] = f[1];
+        triangles[t + 2] = f[2];
+        halfedges[t + 2] = INVALID_INDEX;
+
+        if (constrained.Num() > 0)
+        {
+            constrained[t] = false;
+            constrained[t + 1] = false;
+            constrained[t + 2] = false;
+        }
+
+        for (FIndex j = 0; j < edge_count; ++j)
+        {
+            link(t + j, f[3 + j]);
+
+            if (f[3 + j] == INVALID_INDEX)
+            {
+                hull_tri[f[j]] = t + j;
+            }
+            else
+            if (constrained.Num() > 0)
+            {
+                constrained[t + j] = is_constrained(f[3 + j]);
+            }
+        }
+
+        m_flip_stack.Emplace(t);
+        m_flip_stack.Emplace(t + 1);
+        m_flip_stack.Emplace(t + 2);
+
+        touched.Emplace(t / 3);
+    }
+}
+
+template<typename FReal, typename FIndex>
+FIndex TDelaunator<FReal, FIndex>::find_fill_edge(FIndex first, FIndex count, FIndex a, FIndex b) const
+{
+    // fill edge [a, b] as 3 * fill triangle + corner
+    for (FIndex q = first; q < first + count; ++q)
+    {
+        const FIndex* f = m_fill.GetData() + 6 * q;
+
+        for (FIndex j = 0; j < 3; ++j)
+        {
+            if (f[j] == a && f[(j + 1) % 3] == b)
+            {
+                return 3 * q + j;
+            }
+        }
+    }
+
+    return INVALID_INDEX;
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::constrain(FIndex a, FIndex e, FIndex b)
+{
+    touched.Reset();
+    hull_touched = false;
+
+    if (a == b)
+    {
+        return false;
+    }
+
+    // constraint flags are addressed by int32 bit indices
+    if (halfedges.Num() > MAX_int32)
+    {
+        return false;
+    }
+
+    if (constrained.Num() == 0)
+    {
+        constrained.Init(false, halfedges.Num());
+    }
+
+    m_record_touched = true;
+
+    const bool result = insert_segment(a, e, b);
+
+    m_record_touched = false;
+
+    return result;
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::insert_segment(FIndex a, FIndex e, FIndex b)
+{
+    const FReal ax = coords[2 * a];
+    const FReal ay = coords[2 * a + 1];
+    const FReal bx = coords[2 * b];
+    const FReal by = coords[2 * b + 1];
+
+    // point lies on the segment interior
+    auto on_segment = [&](FIndex p)
+    {
+        const FReal px = coords[2 * p];
+        const FReal py = coords[2 * p + 1];
+
+        return ! orient(bx, by, ax, ay, px, py)
+            && ! orient(bx, by, px, py, ax, ay)
+            && (px - ax) * (bx - ax) + (py - ay) * (by - ay) > 0
+            && dist(ax, ay, px, py) < dist(ax, ay, bx, by);
+    };
+
+    // any halfedge ending at p, looked up in modified triangles
+    auto find_inedge = [&](FIndex p, FIndex hint) -> FIndex
+    {
+        if (triangles[next_halfedge(hint)] == p)
+        {
+            return hint;
+        }
+
+        for (FIndex t : touched)
+        {
+            for (FIndex j = 0; j < 3; ++j)
+            {
+                if (triangles[next_halfedge(3 * t + j)] == p)
+                {
+                    return 3 * t + j;
+                }
+            }
+        }
+
+        return INVALID_INDEX;
+    };
+
+    // split the segment at a collinear point
+    auto split_segment = [&](FIndex p, FIndex hint)
+    {
+        if (! insert_segment(a, e, p))
+        {
+            return false;
+        }
+
+        const FIndex pe = find_inedge(p, hint);
+        return pe != INVALID_INDEX && insert_segment(p, pe, b);
+    };
+
+    // find the existing edge or the triangle around a crossed by the segment
+
+    gather_star(a, e);
+
+    FIndex s = INVALID_INDEX;
+
+    for (FIndex k = 0; k < m_star.Num(); ++k)
+    {
+        const FIndex se = m_star[k];
+        const FIndex u = triangles[next_halfedge(se)];
+        const FIndex v = triangles[prev_halfedge(se)];
+
+        if (u == b)
+        {
+            set_constrained(se, true);
+            return true;
+        }
+
+        if (v == b)
+        {
+            set_constrained(prev_halfedge(se), true);
+            return true;
+        }
+
+        if (on_segment(u))
+        {
+            return split_segment(u, se);
+        }
+
+        if (on_segment(v))
+        {
+            return split_segment(v, next_halfedge(se));
+        }
+
+        if (orient(bx, by, coords[2 * u], coords[2 * u + 1], ax, ay) &&
+            orient(bx, by, ax, ay, coords[2 * v], coords[2 * v + 1]))
+        {
+            s = se;
+            break;
+        }
+    }
+
+    if (s == INVALID_INDEX)
+    {
+        return false;
+    }
+
+    /* walk the triangles crossed by the segment, collecting the cavity
+     * boundary as the chain from a to b on the side of the first
+     * crossed edge origin (upper) and the chain from b to a (lower),
+     * the lower chain is collected backward
+     */
+    TIndexArray<FIndex> slots;
+    TIndexArray<FIndex> upper_v;
+    TIndexArray<FIndex> upper_h;
+    TIndexArray<FIndex> lower_v;
+    TIndexArray<FIndex> lower_h;
+    TIndexArray<FIndex> hull_constraints;
+
+    auto add_boundary = [&](TIndexArray<FIndex>& chain_v, TIndexArray<FIndex>& chain_h, FIndex p, FIndex be)
+    {
+        chain_v.Emplace(p);
+        chain_h.Emplace(halfedges[be]);
+
+        if (halfedges[be] == INVALID_INDEX && is_constrained(be))
+        {
+            hull_constraints.Emplace(triangles[be]);
+        }
+    };
+
+    FIndex u = triangles[next_halfedge(s)];
+    FIndex v = triangles[prev_halfedge(s)];
+    FIndex ce = next_halfedge(s);
+
+    const bool upper_side = orient(coords[2 * u], coords[2 * u + 1], ax, ay, bx, by);
+
+    slots.Emplace(s);
+    upper_v.Emplace(a);
+    lower_v.Emplace(a);
+    add_boundary(upper_v, upper_h, u, s);
+    add_boundary(lower_v, lower_h, v, prev_halfedge(s));
+
+    while (true)
+    {
+        const FIndex o = halfedges[ce];
+
+        // crossing the hull or another constraint
+        if (o == INVALID_INDEX || is_constrained(ce))
+        {
+            return false;
+        }
+
+        const FIndex w = triangles[prev_halfedge(o)];
+
+        slots.Emplace(o);
+
+        if (w == b)
+        {
+            add_boundary(upper_v, upper_h, b, next_halfedge(o));
+            add_boundary(lower_v, lower_h, b, prev_halfedge(o));
+            break;
+        }
+
+        if (on_segment(w))
+        {
+            return split_segment(w, next_halfedge(o));
+        }
+
+        const bool w_side = orient(coords[2 * w], coords[2 * w + 1], ax, ay, bx, by);
+
+        if (w_side == upper_side)
+        {
+            add_boundary(upper_v, upper_h, w, next_halfedge(o));
+            ce = prev_halfedge(o);
+            u = w;
+        }
+        else
+        {
+            add_boundary(lower_v, lower_h, w, prev_halfedge(o));
+            ce = next_halfedge(o);
+            v = w;
+        }
+    }
+
+    /* a point enclosed by the crossed triangles leaves a slit in its chain,
+     * the twin of a slit edge is another cavity edge, so both sides are
+     * cut here and linked to each other after the fill
+     */
+    TIndexArray<FIndex> cavity;
+    TIndexArray<FIndex> slit_edges;
+    cavity.SetNumUninitialized(slots.Num());
+
+    for (FIndex k = 0; k < slots.Num(); ++k)
+    {
+        cavity[k] = slots[k] / 3;
+    }
+
+    cavity.Sort();
+
+    auto cut_slits = [&](TIndexArray<FIndex>& chain_h)
+    {
+        for (FIndex& h : chain_h)
+        {
+            if (h == INVALID_INDEX)
+            {
+                continue;
+            }
+
+            const FIndex i = Algo::LowerBound(cavity, h / 3);
+
+            if (i < cavity.Num() && cavity[i] == h / 3)
+            {
+                slit_edges.Append({ triangles[next_halfedge(h)], triangles[h], is_constrained(h) ? 1 : 0 });
+                h = INVALID_INDEX;
+            }
+        }
+    };
+
+    cut_slits(upper_h);
+    cut_slits(lower_h);
+
+    // lower polygon from b back to a
+
+    TIndexArray<FIndex> poly_v;
+    TIndexArray<FIndex> poly_h;
+    poly_v.SetNumUninitialized(lower_v.Num());
+    poly_h.SetNumUninitialized(lower_v.Num());
+
+    for (FIndex k = 0; k < lower_v.Num(); ++k)
+    {
+        poly_v[k] = lower_v[lower_v.Num() - 1 - k];
+    }
+
+    for (FIndex k = 0; k < lower_h.Num(); ++k)
+    {
+        poly_h[k] = lower_h[lower_h.Num() - 1 - k];
+    }
+
+    // retriangulate both polygons, [b, a] closes the upper polygon
+    // and [a, b] closes the lower one
+
+    m_fill.Reset();
+
+    FIndex fill_count = 0;
+
+    upper_h.Emplace(INVALID_INDEX);
+
+    if (! clip_polygon(upper_v, upper_h, slots, fill_count))
+    {
+        return false;
+    }
+
+    const FIndex upper_count = fill_count;
+    const FIndex uf = find_fill_edge(0, upper_count, b, a);
+    const FIndex ue = 3 * (slots[uf / 3] / 3) + uf % 3;
+
+    poly_h.Last() = ue;
+
+    if (! clip_polygon(poly_v, poly_h, slots, fill_count) || fill_count != slots.Num())
+    {
+        return false;
+    }
+
+    const FIndex lf = find_fill_edge(upper_count, fill_count - upper_count, a, b);
+    const FIndex le = 3 * (slots[lf / 3] / 3) + lf % 3;
+
+    m_fill[6 * (uf / 3) + 3 + uf % 3] = le;
+
+    // link both sides of each slit, the first endpoint is replaced by the
+    // filled halfedge so its constraint flag can be restored after writing
+    for (FIndex k = 0; k < slit_edges.Num(); k += 3)
+    {
+        const FIndex sf = find_fill_edge(0, fill_count, slit_edges[k], slit_edges[k + 1]);
+        const FIndex tf = find_fill_edge(0, fill_count, slit_edges[k + 1], slit_edges[k]);
+
+        if (sf == INVALID_INDEX || tf == INVALID_INDEX)
+        {
+            return false;
+        }
+
+        m_fill[6 * (sf / 3) + 3 + sf % 3] = 3 * (slots[tf / 3] / 3) + tf % 3;
+        slit_edges[k] = 3 * (slots[sf / 3] / 3) + sf % 3;
+    }
+
+    m_flip_stack.Reset();
+
+    write_fill(slots, 0, upper_count, true);
+    write_fill(slots, upper_count, fill_count - upper_count, true);
+
+    set_constrained(ue, true);
+
+    for (FIndex k = 0; k < slit_edges.Num(); k += 3)
+    {
+        set_constrained(slit_edges[k], slit_edges[k + 2] != 0);
+    }
+
+    for (FIndex p : hull_constraints)
+    {
+        constrained[hull_tri[p]] = true;
+    }
+
+    flip_edges();
+
+    return true;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::get_region_depths(TIndexArray<FIndex>& out_depths) const
+{
+    // flood fill from the hull, crossing a constrained edge
+    // increments the depth, odd depths are inside constrained polygons
+
+    const FIndex tri_count = triangles.Num() / 3;
+
+    out_depths.Init(INVALID_INDEX, tri_count);
+
+    if (tri_count == 0)
+    {
+        return;
+    }
+
+    TIndexArray<FIndex> queue;
+    TIndexArray<FIndex> next_queue;
+
+    FIndex e = hull_start;
+    do
+    {
+        const FIndex t = hull_tri[e] / 3;
+
+        if (! is_constrained(hull_tri[e]))
+        {
+            out_depths[t] = 0;
+            queue.Emplace(t);
+        }
+        else
+        if (out_depths[t] == INVALID_INDEX)
+        {
+            out_depths[t] = 1;
+            next_queue.Emplace(t);
+        }
+
+        e = hull_next[e];
+    }
+    while (e != hull_start);
+
+    for (FIndex depth = 0; queue.Num() > 0 || next_queue.Num() > 0; ++depth)
+    {
+        while (queue.Num() > 0)
+        {
+            const FIndex t = queue.Pop(false);
+
+            // reached with a lower depth from the previous layer
+            if (out_depths[t] != depth)
+            {
+                continue;
+            }
+
+            for (FIndex j = 0; j < 3; ++j)
+            {
+                const FIndex o = halfedges[3 * t + j];
+
+                if (o == INVALID_INDEX)
+                {
+                    continue;
+                }
+
+                const FIndex nt = o / 3;
+
+                if (! is_constrained(o))
+                {
+                    if (out_depths[nt] == INVALID_INDEX || out_depths[nt] > depth)
+                    {
+                        out_depths[nt] = depth;
+                        queue.Emplace(nt);
+                    }
+                }
+                else
+                if (out_depths[nt] == INVALID_INDEX)
+                {
+                    out_depths[nt] = depth + 1;
+                    next_queue.Emplace(nt);
+                }
+            }
+        }
+
+        Swap(queue, next_queue);
+    }
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::check_star(FIndex e, FReal x, FReal y) const
+{
+    // check whether the triangles around the end point of halfedge e
+    // keep their orientation with the point moved to (x, y)
+
+    const FIndex start = next_halfedge(e);
+    FIndex se = start;
+    do
+    {
+        const FIndex a = triangles[next_halfedge(se)];
+        const FIndex b = triangles[prev_halfedge(se)];
+        const FReal ax = coords[2 * a];
+        const FReal ay = coords[2 * a + 1];
+        const FReal bx = coords[2 * b];
+        const FReal by = coords[2 * b + 1];
+
+        if (! orient(x, y, bx, by, ax, ay) || check_pts_equal(x, y, ax, ay))
+        {
+            return false;
+        }
+
+        se = halfedges[prev_halfedge(se)];
+
+        // hull point, moving might change the hull
+        if (se == INVALID_INDEX)
+        {
+            return false;
+        }
+    }
+    while (se != start);
+
+    return true;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::flip_star(FIndex e)
+{
+    touched.Reset();
+    hull_touched = false;
+
+    m_record_touched = true;
+    m_flip_stack.Reset();
+
+    // spokes and link edges around the end point of halfedge e
+
+    const FIndex start = next_halfedge(e);
+    FIndex se = start;
+    do
+    {
+        m_flip_stack.Emplace(se);
+        m_flip_stack.Emplace(next_halfedge(se));
+        se = halfedges[prev_halfedge(se)];
+    }
+    while (se != start && se != INVALID_INDEX);
+
+    flip_edges();
+
+    m_record_touched = false;
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::flip_edges()
+{
+    // lawson flips until all edges in the stack are locally delaunay,
+    // bounded in case of float predicate inconsistencies
+    FIndex flip_limit = 64 * (m_flip_stack.Num() + 16);
+
+    while (m_flip_stack.Num() > 0 && flip_limit > 0)
+    {
+        const FIndex a = m_flip_stack.Pop(false);
+        const FIndex b = halfedges[a];
+
+        if (b == INVALID_INDEX)
+        {
+            continue;
+        }
+
+        const FIndex a0 = 3 * (a / 3);
+        const FIndex b0 = 3 * (b / 3);
+        const FIndex al = a0 + (a + 1) % 3;
+        const FIndex ar = a0 + (a + 2) % 3;
+        const FIndex bl = b0 + (b + 2) % 3;
+        const FIndex br = b0 + (b + 1) % 3;
+
+        const FIndex p0 = triangles[ar];
+        const FIndex pr = triangles[a];
+        const FIndex pl = triangles[al];
+        const FIndex p1 = triangles[bl];
+
+        const bool illegal = ! is_constrained(a) && in_circle(
+            coords[2 * p0],
+            coords[2 * p0 + 1],
+            coords[2 * pr],
+            coords[2 * pr + 1],
+            coords[2 * pl],
+            coords[2 * pl + 1],
+            coords[2 * p1],
+            coords[2 * p1 + 1]);
+
+        if (! illegal)
+        {
+            continue;
+        }
+
+        triangles[a] = p1;
+        triangles[b] = p0;
+
+        move_constrained(bl, a);
+        move_constrained(ar, b);
+
+        const FIndex hbl = halfedges[bl];
+        const FIndex har = halfedges[ar];
+
+        // outer edges moved to the other slot, fix hull references
+        if (hbl == INVALID_INDEX)
+        {
+            hull_tri[p1] = a;
+        }
+
+        if (har == INVALID_INDEX)
+        {
+            hull_tri[p0] = b;
+        }
+
+        link(a, hbl);
+        link(b, har);
+        link(ar, bl);
+
+        if (m_record_touched)
+        {
+            touched.Emplace(a / 3);
+            touched.Emplace(b / 3);
+        }
+
+        m_flip_stack.Emplace(a);
+        m_flip_stack.Emplace(al);
+        m_flip_stack.Emplace(b);
+        m_flip_stack.Emplace(br);
+
+        --flip_limit;
+    }
+
+    m_flip_stack.Reset();
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::move_triangle(FIndex src, FIndex dst)
+{
+    for (FIndex j = 0; j < 3; ++j)
+    {
+        const FIndex se = 3 * src + j;
+        const FIndex de = 3 * dst + j;
+        const FIndex o = halfedges[se];
+
+        triangles[de] = triangles[se];
+        halfedges[de] = o;
+
+        if (constrained.Num() > 0)
+        {
+            constrained[de] = is_constrained(se);
+        }
+
+        if (o != INVALID_INDEX)
+        {
+            halfedges[o] = de;
+        }
+        else
+        {
+            hull_tri[triangles[se]] = de;
+        }
+    }
+}
+
+template<typename FReal, typename FIndex>
+bool TDelaunator<FReal, FIndex>::update_slabs(FIndex slab_count)
+{
+    const FIndex n = coords.Num() >> 1;
+    const FReal* xy = coords.GetData();
+
+    const FIndex chunk_size = 1 << 16;
+    const FIndex chunk_count = FMath::DivideAndRoundUp(n, chunk_size);
+
+    // find x range
+
+    TArray<FReal> chunk_min_x;
+    TArray<FReal> chunk_max_x;
+    chunk_min_x.SetNumUninitialized(chunk_count);
+    chunk_max_x.SetNumUninitialized(chunk_count);
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        const FIndex i0 = c * chunk_size;
+        const FIndex i1 = FMath::Min(i0 + chunk_size, n);
+
+        FReal lo = xy[2 * i0];
+        FReal hi = lo;
+
+        for (FIndex i = i0 + 1; i < i1; ++i)
+        {
+            lo = FMath::Min(lo, xy[2 * i]);
+            hi = FMath::Max(hi, xy[2 * i]);
+        }
+
+        chunk_min_x[c] = lo;
+        chunk_max_x[c] = hi;
+    } );
+
+    FReal min_x = chunk_min_x[0];
+    FReal max_x = chunk_max_x[0];
+
+    for (FIndex c = 1; c < chunk_count; ++c)
+    {
+        min_x = FMath::Min(min_x, chunk_min_x[c]);
+        max_x = FMath::Max(max_x, chunk_max_x[c]);
+    }
+
+    if (! (min_x < max_x))
+    {
+        return false;
+    }
+
+    // bucket points by x and group buckets into slabs of similar size
+
+    const FIndex bucket_count = slab_count * 64;
+    const FReal bucket_scale = bucket_count / (max_x - min_x);
+
+    auto get_bucket = [=](FReal x)
+    {
+        const FIndex b = FMath::FloorToInt(static_cast<float>((x - min_x) * bucket_scale));
+        return FMath::Clamp<FIndex>(b, 0, bucket_count - 1);
+    };
+
+    TIndexArray<FIndex> chunk_counts;
+    chunk_counts.SetNumZeroed(chunk_count * bucket_count);
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        const FIndex i0 = c * chunk_size;
+        const FIndex i1 = FMath::Min(i0 + chunk_size, n);
+        FIndex* counts = chunk_counts.GetData() + c * bucket_count;
+
+        for (FIndex i = i0; i < i1; ++i)
+        {
+            ++counts[get_bucket(xy[2 * i])];
+        }
+    } );
+
+    TIndexArray<FIndex> bucket_slab;
+    bucket_slab.SetNumUninitialized(bucket_count);
+
+    TIndexArray<FIndex> chunk_offsets;
+    chunk_offsets.SetNumZeroed(chunk_count * slab_count);
+
+    {
+        int64 total = 0;
+
+        for (FIndex b = 0; b < bucket_count; ++b)
+        {
+            const FIndex s = static_cast<FIndex>((total * slab_count) / n);
+            bucket_slab[b] = s;
+
+            for (FIndex c = 0; c < chunk_count; ++c)
+            {
+                const FIndex count = chunk_counts[c * bucket_count + b];
+                chunk_offsets[c * slab_count + s] += count;
+                total += count;
+            }
+        }
+    }
+
+    TArray<slab_data<FReal, FIndex>> slabs;
+    slabs.SetNum(slab_count);
+
+    for (FIndex s = 0; s < slab_count; ++s)
+    {
+        FIndex offset = 0;
+
+        for (FIndex c = 0; c < chunk_count; ++c)
+        {
+            const FIndex count = chunk_offsets[c * slab_count + s];
+            chunk_offsets[c * slab_count + s] = offset;
+            offset += count;
+        }
+
+        slabs[s].ids.SetNumUninitialized(offset);
+        slabs[s].coords.SetNumUninitialized(offset * 2);
+    }
+
+    // scatter points into slabs, slab order preserves input order
+
+    ParallelFor(chunk_count, [&](int32 c)
+    {
+        const FIndex i0 = c * chunk_size;
+        const FIndex i1 = FMath::Min(i0 + chunk_size, n);
+        FIndex* offsets = chunk_offsets.GetData() + c * slab_count;
+
+        for (FIndex i = i0; i < i1; ++i)
+        {
+            const FReal x = xy[2 * i];
+            const FReal y = xy[2 * i + 1];
+
+            const FIndex s = bucket_slab[get_bucket(x)];
+            const FIndex j = offsets[s]++;
+            slab_data<FReal, FIndex>& slab(slabs[s]);
+
+            slab.ids[j] = i;
+            slab.coords[2 * j] = x;
+            slab.coords[2 * j + 1] = y;
+        }
+    } );
+
+    ParallelFor(slab_count, [&](int32 s)
+    {
+        slab_data<FReal, FIndex>& slab(slabs[s]);
+        slab.min_x = TNumericLimits<FReal>::Max();
+        slab.max_x = TNumericLimits<FReal>::Lowest();
+
+        for (FIndex i = 0; i < slab.ids.Num(); ++i)
+        {
+            slab.min_x = FMath::Min(slab.min_x, slab.coords[2 * i]);
+            slab.max_x = FMath::Max(slab.max_x, slab.coords[2 * i]);
+        }
+    } );
+
+    // x extent of points outside each slab
+
+    TArray<double> left_bounds;
+    TArray<double> right_bounds;
+    left_bounds.SetNumUninitialized(slab_count);
+    right_bounds.SetNumUninitialized(slab_count);
+
+    {
+        double bound = TNumericLimits<double>::Lowest();
+
+        for (FIndex s = 0; s < slab_count; ++s)
+        {
+            left_bounds[s] = bound;
+
+            if (slabs[s].ids.Num() > 0)
+            {
+                bound = slabs[s].max_x;
+            }
+        }
+
+        bound = TNumericLimits<double>::Max();
+
+        for (FIndex s = slab_count - 1; s >= 0; --s)
+        {
+            right_bounds[s] = bound;
+
+            if (slabs[s].ids.Num() > 0)
+            {
+                bound = slabs[s].min_x;
+            }
+        }
+    }
+
+    // triangulate slabs, triangles with circumcircle strictly within
+    // the slab x extent are final, the rest goes into the seam pass
+
+    TArray<uint8> seam_flags;
+    seam_flags.SetNumZeroed(n);
+
+    ParallelFor(slab_count, [&](int32 s)
+    {
+        slab_data<FReal, FIndex>& slab(slabs[s]);
+        slab.triangles.Reset();
+        slab.halfedges.Reset();
+        slab.seam_edges.Reset();
+
+        auto flag_slab_seam = [&]()
+        {
+            for (FIndex id : slab.ids)
+            {
+                seam_flags[id] = 1;
+            }
+        };
+
+        if (is_collinear(slab.coords))
+        {
+            flag_slab_seam();
+            return;
+        }
+
+        const TDelaunator d(slab.coords.GetData(), slab.coords.Num(), robust_predicates);
+
+        // degenerate within rounding, no triangulation
+        if (d.triangles.Num() == 0)
+        {
+            flag_slab_seam();
+            return;
+        }
+
+        const TArray<FReal>& sxy(slab.coords);
+        const FIndex tri_count = d.triangles.Num() / 3;
+        const double left = left_bounds[s];
+        const double right = right_bounds[s];
+
+        TIndexArray<FIndex> final_index;
+        final_index.SetNumUninitialized(tri_count);
+        FIndex final_count = 0;
+
+        for (FIndex t = 0; t < tri_count; ++t)
+        {
+            const FIndex i0 = d.triangles[3 * t];
+            const FIndex i1 = d.triangles[3 * t + 1];
+            const FIndex i2 = d.triangles[3 * t + 2];
+
+            const double ax = sxy[2 * i0];
+            const double ay = sxy[2 * i0 + 1];
+            const double dx = sxy[2 * i1] - ax;
+            const double dy = sxy[2 * i1 + 1] - ay;
+            const double ex = sxy[2 * i2] - ax;
+            const double ey = sxy[2 * i2 + 1] - ay;
+
+            const double bl = dx * dx + dy * dy;
+            const double cl = ex * ex + ey * ey;
+            const double det = dx * ey - dy * ex;
+
+            bool bFinal = (det != 0.0);
+
+            if (bFinal)
+            {
+                const double ox = (ey * bl - dy * cl) * 0.5 / det;
+                const double oy = (dx * cl - ex * bl) * 0.5 / det;
+                const double cx = ax + ox;
+
+                // small margin against float predicate error in the slab pass
+                const double r2 = (ox * ox + oy * oy) * (1.0 + 1e-5);
+
+                bFinal = (cx > left && (cx - left) * (cx - left) > r2)
+                    && (cx < right && (right - cx) * (right - cx) > r2);
+            }
+
+            if (bFinal)
+            {
+                final_index[t] = final_count++;
+            }
+            else
+            {
+                final_index[t] = INVALID_INDEX;
+                seam_flags[slab.ids[i0]] = 1;
+                seam_flags[slab.ids[i1]] = 1;
+                seam_flags[slab.ids[i2]] = 1;
+            }
+        }
+
+        // slab hull points are always on the seam
+
+        FIndex e = d.hull_start;
+        do
+        {
+            seam_flags[slab.ids[e]] = 1;
+            e = d.hull_next[e];
+        }
+        while (e != d.hull_start);
+
+        slab.triangles.SetNumUninitialized(final_count * 3);
+        slab.halfedges.SetNumUninitialized(final_count * 3);
+
+        for (FIndex t = 0; t < tri_count; ++t)
+        {
+            if (final_index[t] == INVALID_INDEX)
+            {
+                continue;
+            }
+
+            for (FIndex j = 0; j < 3; ++j)
+            {
+                const FIndex se = 3 * t + j;
+                const FIndex fe = 3 * final_index[t] + j;
+                const FIndex so = d.halfedges[se];
+
+                slab.triangles[fe] = slab.ids[d.triangles[se]];
+
+                if (so != INVALID_INDEX && final_index[so / 3] != INVALID_INDEX)
+                {
+                    slab.halfedges[fe] = 3 * final_index[so / 3] + so % 3;
+                }
+                else
+                {
+                    slab.halfedges[fe] = INVALID_INDEX;
+                    slab.seam_edges.Emplace(fe);
+                }
+            }
+        }
+    } );
+
+    // gather seam points
+
+    TIndexArray<FIndex> seam_ids;
+    TArray<FReal> seam_coords;
+    TIndexArray<FIndex> seam_index;
+    seam_index.SetNumUninitialized(n);
+
+    FIndex final_count = 0;
+
+    for (slab_data<FReal, FIndex>& slab : slabs)
+    {
+        slab.triangle_offset = final_count;
+        final_count += slab.triangles.Num() / 3;
+
+        for (FIndex id : slab.ids)
+        {
+            if (seam_flags[id])
+            {
+                seam_index[id] = seam_ids.Num();
+                seam_ids.Emplace(id);
+                seam_coords.Emplace(xy[2 * id]);
+                seam_coords.Emplace(xy[2 * id + 1]);
+            }
+        }
+    }
+
+    if (final_count == 0 || is_collinear(seam_coords))
+    {
+        return false;
+    }
+
+    const TDelaunator seam(seam_coords.GetData(), seam_coords.Num(), robust_predicates);
+    const FIndex seam_edge_count = seam.triangles.Num();
+    const FIndex seam_tri_count = seam_edge_count / 3;
+
+    // outgoing halfedge of each seam point, hull edges first
+
+    TIndexArray<FIndex> seam_out;
+    seam_out.SetNumUninitialized(seam_ids.Num());
+    FMemory::Memset(seam_out.GetData(), ~0, seam_out.Num()*seam_out.GetTypeSize());
+
+    for (FIndex e = 0; e < seam_edge_count; ++e)
+    {
+        const FIndex p = seam.triangles[e];
+
+        if (seam_out[p] == INVALID_INDEX || seam.halfedges[e] == INVALID_INDEX)
+        {
+            seam_out[p] = e;
+        }
+    }
+
+    auto find_seam_edge = [&](FIndex u, FIndex v) -> FIndex
+    {
+        const FIndex start = seam_out[u];
+        FIndex e = start;
+
+        while (e != INVALID_INDEX)
+        {
+            if (seam.triangles[next_halfedge(e)] == v)
+            {
+                return e;
+            }
+
+            e = seam.halfedges[prev_halfedge(e)];
+
+            if (e == start)
+            {
+                break;
+            }
+        }
+
+        return INVALID_INDEX;
+    };
+
+    // match final triangle seam edges to seam triangulation halfedges,
+    // seam_edge_final maps blocking seam halfedges to their final twin
+    // and seam_edge_global maps seam halfedges to output halfedges
+
+    TIndexArray<FIndex> seam_edge_final;
+    TIndexArray<FIndex> seam_edge_global;
+    seam_edge_final.SetNumUninitialized(seam_edge_count);
+    seam_edge_global.SetNumUninitialized(seam_edge_count);
+    FMemory::Memset(seam_edge_final.GetData(), ~0, seam_edge_count*seam_edge_final.GetTypeSize());
+    FMemory::Memset(seam_edge_global.GetData(), ~0, seam_edge_count*seam_edge_global.GetTypeSize());
+
+    ParallelFor(slab_count, [&](int32 s)
+    {
+        slab_data<FReal, FIndex>& slab(slabs[s]);
+        const FIndex offset = slab.triangle_offset * 3;
+
+        slab.valid = true;
+        slab.seam_partners.SetNumUninitialized(slab.seam_edges.Num());
+
+        for (FIndex k = 0; k < slab.seam_edges.Num(); ++k)
+        {
+            const FIndex fe = slab.seam_edges[k];
+            const FIndex u = seam_index[slab.triangles[fe]];
+            const FIndex v = seam_index[slab.triangles[next_halfedge(fe)]];
+            const FIndex eo = find_seam_edge(v, u);
+
+            if (eo != INVALID_INDEX)
+            {
+                seam_edge_final[eo] = offset + fe;
+                slab.seam_partners[k] = eo;
+                continue;
+            }
+
+            // no twin, must be an edge on the global hull
+
+            const FIndex es = find_seam_edge(u, v);
+
+            if (es != INVALID_INDEX && seam.halfedges[es] == INVALID_INDEX)
+            {
+                seam_edge_global[es] = offset + fe;
+                slab.seam_partners[k] = INVALID_INDEX;
+                continue;
+            }
+
+            slab.valid = false;
+            return;
+        }
+    } );
+
+    for (const slab_data<FReal, FIndex>& slab : slabs)
+    {
+        if (! slab.valid)
+        {
+            return false;
+        }
+    }
+
+    // flood fill seam triangles bounded by the final triangles
+
+    TIndexArray<FIndex> seam_tri_index;
+    seam_tri_index.SetNumUninitialized(seam_tri_count);
+    FMemory::Memset(seam_tri_index.GetData(), ~0, seam_tri_count*seam_tri_index.GetTypeSize());
+
+    TIndexArray<FIndex> tri_stack;
+    FIndex fill_count = 0;
+
+    for (FIndex e = 0; e < seam_edge_count; ++e)
+    {
+        if (seam_edge_final[e] == INVALID_INDEX || seam_tri_index[e / 3] != INVALID_INDEX)
+        {
+            continue;
+        }
+
+        seam_tri_index[e / 3] = fill_count++;
+        tri_stack.Emplace(e / 3);
+
+        while (tri_stack.Num() > 0)
+        {
+            const FIndex t = tri_stack.Pop(false);
+
+            for (FIndex j = 0; j < 3; ++j)
+            {
+                const FIndex se = 3 * t + j;
+                const FIndex so = seam.halfedges[se];
+
+                if (so != INVALID_INDEX
+                    && seam_edge_final[se] == INVALID_INDEX
+                    && seam_tri_index[so / 3] == INVALID_INDEX)
+                {
+                    seam_tri_index[so / 3] = fill_count++;
+                    tri_stack.Emplace(so / 3);
+                }
+            }
+        }
+    }
+
+    for (FIndex e = 0; e < seam_edge_count; ++e)
+    {
+        if (seam_tri_index[e / 3] != INVALID_INDEX)
+        {
+            seam_edge_global[e] = 3 * (final_count + seam_tri_index[e / 3]) + e % 3;
+        }
+    }
+
+    // validate triangle count against euler formula of the merged mesh
+
+    FMemory::Memset(seam_flags.GetData(), 0, n);
+
+    ParallelFor(slab_count, [&](int32 s)
+    {
+        for (FIndex id : slabs[s].triangles)
+        {
+            seam_flags[id] = 1;
+        }
+    } );
+
+    for (FIndex e = 0; e < seam_edge_count; ++e)
+    {
+        if (seam_tri_index[e / 3] != INVALID_INDEX)
+        {
+            seam_flags[seam_ids[seam.triangles[e]]] = 1;
+        }
+    }
+
+    FIndex used_count = 0;
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        used_count += seam_flags[i];
+    }
+
+    const FIndex tri_count = final_count + fill_count;
+
+    if (tri_count != 2 * used_count - seam.hull_size - 2)
+    {
+        return false;
+    }
+
+    // merge final and seam triangles
+
+    triangles.SetNumUninitialized(tri_count * 3);
+    halfedges.SetNumUninitialized(tri_count * 3);
+
+    for (FIndex se = 0; se < seam_edge_count; ++se)
+    {
+        const FIndex e = seam_edge_global[se];
+
+        if (seam_tri_index[se / 3] == INVALID_INDEX)
+        {
+            continue;
+        }
+
+        const FIndex so = seam.halfedges[se];
+        const bool bBarrier = (seam_edge_final[se] != INVALID_INDEX);
+
+        triangles[e] = seam_ids[seam.triangles[se]];
+
+        if (so == INVALID_INDEX)
+        {
+            halfedges[e] = INVALID_INDEX;
+        }
+        else
+        if (bBarrier && seam_tri_index[so / 3] == INVALID_INDEX)
+        {
+            halfedges[e] = seam_edge_final[se];
+        }
+        else
+        if (! bBarrier)
+        {
+            halfedges[e] = seam_edge_global[so];
+        }
+        else
+        {
+            // final triangles overlap the seam triangulation
+            return false;
+        }
+    }
+
+    ParallelFor(slab_count, [&](int32 s)
+    {
+        const slab_data<FReal, FIndex>& slab(slabs[s]);
+        const FIndex offset = slab.triangle_offset * 3;
+
+        for (FIndex fe = 0; fe < slab.triangles.Num(); ++fe)
+        {
+            const FIndex h = slab.halfedges[fe];
+            triangles[offset + fe] = slab.triangles[fe];
+            halfedges[offset + fe] = (h != INVALID_INDEX) ? offset + h : INVALID_INDEX;
+        }
+
+        for (FIndex k = 0; k < slab.seam_edges.Num(); ++k)
+        {
+            const FIndex eo = slab.seam_partners[k];
+            halfedges[offset + slab.seam_edges[k]] =
+                (eo != INVALID_INDEX) ? seam_edge_global[eo] : INVALID_INDEX;
+        }
+    } );
+
+    // the seam triangulation shares the global convex hull
+
+    hull_prev.SetNumUninitialized(n);
+    hull_next.SetNumUninitialized(n);
+    hull_tri.SetNumUninitialized(n);
+
+    hull_start = seam_ids[seam.hull_start];
+    hull_size = seam.hull_size;
+
+    FIndex e = seam.hull_start;
+    do
+    {
+        const FIndex i = seam_ids[e];
+        hull_prev[i] = seam_ids[seam.hull_prev[e]];
+        hull_next[i] = seam_ids[seam.hull_next[e]];
+        hull_tri[i] = seam_edge_global[seam.hull_tri[e]];
+
+        if (hull_tri[i] == INVALID_INDEX)
+        {
+            return false;
+        }
+
+        e = seam.hull_next[e];
+    }
+    while (e != seam.hull_start);
+
+    return true;
+}
+
+template<typename FReal, typename FIndex>
+void hilbert_order(const TArrayView<const FReal>& coords, TIndexArray<FIndex>& out_order)
+{
+    const FIndex n = coords.Num() >> 1;
+
+    out_order.SetNumUninitialized(n);
+
+    if (n < 1)
+    {
+        return;
+    }
+
+    FReal min_x = TNumericLimits<FReal>::Max();
+    FReal min_y = TNumericLimits<FReal>::Max();
+    FReal max_x = TNumericLimits<FReal>::Lowest();
+    FReal max_y = TNumericLimits<FReal>::Lowest();
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        min_x = FMath::Min(min_x, coords[2 * i]);
+        min_y = FMath::Min(min_y, coords[2 * i + 1]);
+        max_x = FMath::Max(max_x, coords[2 * i]);
+        max_y = FMath::Max(max_y, coords[2 * i + 1]);
+    }
+
+    // quantize to the curve grid, sort by curve distance then point id
+
+    const double scale_x = max_x > min_x ? 65535.0 / (double(max_x) - min_x) : 0.0;
+    const double scale_y = max_y > min_y ? 65535.0 / (double(max_y) - min_y) : 0.0;
+
+    TArray<uint64> keys;
+    keys.SetNumUninitialized(n);
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        const uint32 x = static_cast<uint32>((double(coords[2 * i]) - min_x) * scale_x);
+        const uint32 y = static_cast<uint32>((double(coords[2 * i + 1]) - min_y) * scale_y);
+        keys[i] = (uint64(hilbert_index(x, y)) << 32) | uint32(i);
+    }
+
+    keys.Sort();
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        out_order[i] = static_cast<FIndex>(keys[i] & 0xFFFFFFFFu);
+    }
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::renumber(const TIndexArray<FIndex>& point_order)
+{
+    const FIndex n = point_order.Num();
+    const FIndex triangle_count = triangles.Num() / 3;
+
+    if (triangle_count < 1)
+    {
+        return;
+    }
+
+    TIndexArray<FIndex> point_map;
+    point_map.SetNumUninitialized(n);
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        point_map[point_order[i]] = i;
+    }
+
+    // counting sort triangles by their lowest new point index
+
+    TIndexArray<FIndex> offsets;
+    TIndexArray<FIndex> triangle_map;
+    offsets.SetNumZeroed(n + 1);
+    triangle_map.SetNumUninitialized(triangle_count);
+
+    for (FIndex t = 0; t < triangle_count; ++t)
+    {
+        triangle_map[t] = FMath::Min3(
+            point_map[triangles[3 * t]],
+            point_map[triangles[3 * t + 1]],
+            point_map[triangles[3 * t + 2]]);
+
+        ++offsets[triangle_map[t] + 1];
+    }
+
+    for (FIndex i = 0; i < n; ++i)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    for (FIndex t = 0; t < triangle_count; ++t)
+    {
+        triangle_map[t] = offsets[triangle_map[t]]++;
+    }
+
+    auto map_edge = [&triangle_map](FIndex e)
+    {
+        return e == INVALID_INDEX ? INVALID_INDEX : 3 * triangle_map[e / 3] + e % 3;
+    };
+
+    // rewrite triangles, halfedges and constraint flags
+
+    TIndexArray<FIndex> new_triangles;
+    TIndexArray<FIndex> new_halfedges;
+    new_triangles.SetNumUninitialized(triangles.Num());
+    new_halfedges.SetNumUninitialized(halfedges.Num());
+
+    for (FIndex e = 0; e < triangles.Num(); ++e)
+    {
+        const FIndex ne = map_edge(e);
+        new_triangles[ne] = point_map[triangles[e]];
+        new_halfedges[ne] = map_edge(halfedges[e]);
+    }
+
+    Swap(triangles, new_triangles);
+    Swap(halfedges, new_halfedges);
+
+    if (constrained.Num() > 0)
+    {
+        TBitArray<> new_constrained;
+        new_constrained.Init(false, constrained.Num());
+
+        for (FIndex e = 0; e < constrained.Num(); ++e)
+        {
+            new_constrained[map_edge(e)] = constrained[e];
+        }
+
+        Swap(constrained, new_constrained);
+    }
+
+    // rewrite hull links of hull points
+
+    TIndexArray<FIndex> new_prev;
+    TIndexArray<FIndex> new_next;
+    TIndexArray<FIndex> new_tri;
+    new_prev.Init(INVALID_INDEX, n);
+    new_next.Init(INVALID_INDEX, n);
+    new_tri.Init(INVALID_INDEX, n);
+
+    FIndex e = hull_start;
+    do
+    {
+        const FIndex i = point_map[e];
+        new_prev[i] = point_map[hull_prev[e]];
+        new_next[i] = point_map[hull_next[e]];
+        new_tri[i] = map_edge(hull_tri[e]);
+        e = hull_next[e];
+    }
+    while (e != hull_start);
+
+    hull_start = point_map[hull_start];
+
+    Swap(hull_prev, new_prev);
+    Swap(hull_next, new_next);
+    Swap(hull_tri, new_tri);
+
+    for (FIndex& h : m_hash)
+    {
+        if (h != INVALID_INDEX)
+        {
+            h = point_map[h];
+        }
+    }
+
+    touched.Reset();
+}
+
+template<typename FReal, typename FIndex>
+void TDelaunator<FReal, FIndex>::assign(TIndexArray<FIndex>&& in_triangles, TIndexArray<FIndex>&& in_halfedges)
+{
+    check(in_triangles.Num() == in_halfedges.Num());
+
+    const FIndex n = coords.Num() / 2;
+
+    triangles = MoveTemp(in_triangles);
+    halfedges = MoveTemp(in_halfedges);
+    constrained.Empty();
+    touched.Reset();
+
+    // the hash only seeds hull lookups of a full update
+    m_hash.Reset();
+    m_hash_size = 0;
+
+    hull_prev.Init(INVALID_INDEX, n);
+    hull_next.Init(INVALID_INDEX, n);
+    hull_tri.Init(INVALID_INDEX, n);
+    hull_start = INVALID_INDEX;
+    hull_size = 0;
+
+    for (FIndex e = 0; e < halfedges.Num(); ++e)
+    {
+        if (halfedges[e] == INVALID_INDEX)
+        {
+            const FIndex a = triangles[e];
+            const FIndex b = triangles[next_halfedge(e)];
+
+            hull_next[a] = b;
+            hull_prev[b] = a;
+            hull_tri[a] = e;
+
+            if (hull_start == INVALID_INDEX)
+            {
+                hull_start = a;
+            }
+        }
+    }
+
+    if (hull_start == INVALID_INDEX)
+    {
+        return;
+    }
+
+    // boundaries pinched at a point may not lead back to the start,
+    // restart from the first repeated point so the hull walk is a cycle
+
+    TBitArray<> visited(false, n);
+    FIndex e = hull_start;
+
+    while (hull_next[e] != INVALID_INDEX && ! visited[e])
+    {
+        visited[e] = true;
+        e = hull_next[e];
+    }
+
+    if (hull_next[e] == INVALID_INDEX)
+    {
+        hull_next[e] = hull_start;
+        hull_prev[hull_start] = e;
+        e = hull_start;
+    }
+
+    hull_start = e;
+
+    do
+    {
+        ++hull_size;
+        e = hull_next[e];
+    }
+    while (e != hull_start);
+}
+
+template class TDelaunator<float>;
+template class TDelaunator<double>;
+template class TDelaunator<float, int64>;
+template class TDelaunator<double, int64>;
+
+template void hilbert_order<float, int32>(const TArrayView<const float>&, TIndexArray<int32>&);
+template void hilbert_order<double, int32>(const TArrayView<const double>&, TIndexArray<int32>&);
+template void hilbert_order<float, int64>(const TArrayView<const float>&, TIndexArray<int64>&);
+template void hilbert_order<double, int64>(const TArrayView<const double>&, TIndexArray<int64>&);
+
 } //namespace delaunator
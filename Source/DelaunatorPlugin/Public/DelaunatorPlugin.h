@@ -28,6 +28,7 @@
 #pragma once
 
 #include "ModuleManager.h"
+#include "Stats/Stats.h"
 
 class FDelaunatorPlugin : public IModuleInterface
 {
@@ -39,3 +40,12 @@ public:
 };
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDel, Verbose, All);
+
+DECLARE_STATS_GROUP(TEXT("Delaunator"), STATGROUP_Delaunator, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Legalize Flips"), STAT_DelaunatorLegalizeFlips, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hull Hash Probes"), STAT_DelaunatorHullHashProbes, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hull Walk Steps"), STAT_DelaunatorHullWalkSteps, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("FindCloser Iterations"), STAT_DelaunatorFindCloserIterations, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visited Nodes"), STAT_DelaunatorVisitedNodes, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Allocated Memory"), STAT_DelaunatorAllocatedMemory, STATGROUP_Delaunator, DELAUNATORPLUGIN_API);